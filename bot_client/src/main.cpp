@@ -0,0 +1,155 @@
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "meta_program/meta_program.hpp"
+#include "networking/client_networking/network.hpp"
+#include "networking/transport/transport.hpp"
+#include "networking/network_sim/network_sim.hpp"
+#include "networking/udp_transport/udp_transport.hpp"
+#include "networking/wire_format/wire_format.hpp"
+
+#include "utility/fixed_frequency_loop/fixed_frequency_loop.hpp"
+#include "utility/logger/logger.hpp"
+#include "utility/config_file_parser/config_file_parser.hpp"
+#include "utility/meta_utils/meta_utils.hpp"
+
+#include "system_logic/bot_session/bot_session.hpp"
+
+int main() {
+
+    global_logger.remove_all_sinks();
+    global_logger.add_file_sink("logs.txt");
+
+    Configuration configuration("assets/config/user_cfg.ini");
+
+    if (configuration.get_value("general", "development_mode") == "on") {
+        meta_utils::CustomTypeExtractionSettings settings("src/networking/packet_types/packet_types.hpp");
+        meta_utils::CustomTypeExtractionSettings settings1("src/networking/packet_data/packet_data.hpp");
+        meta_utils::CustomTypeExtractionSettings settings2("src/sound/sound_types/sound_types.hpp");
+        meta_utils::CustomTypeExtractionSettings settings3("src/networking/packets/packets.hpp");
+        meta_utils::register_custom_types_into_meta_types({settings, settings1, settings2, settings3});
+        meta_utils::generate_string_invokers_program_wide({}, meta_utils::meta_types.get_concrete_types());
+    }
+
+    meta_program::MetaProgram mp(meta_utils::meta_types.get_concrete_types());
+
+    std::string ip_address = configuration.get_value("network", "server_ip").value_or("localhost");
+
+    BotBehaviour behaviour;
+    behaviour.mouse_path = mouse_path_from_string(configuration.get_value("bots", "mouse_path").value_or("circle"));
+    behaviour.mouse_speed = std::stod(configuration.get_value("bots", "mouse_speed").value_or("600"));
+    behaviour.fire_rate = std::stod(configuration.get_value("bots", "fire_rate").value_or("2"));
+    behaviour.sensitivity = std::stod(configuration.get_value("bots", "sensitivity").value_or("1"));
+    behaviour.send_quantized_packets = configuration.get_value("network", "quantized_packets") == "on";
+    behaviour.mouse_update_window_size = std::clamp<size_t>(
+        std::stoul(configuration.get_value("network", "mouse_update_window").value_or("1")), 1,
+        wire_format::quantization::max_mouse_update_window_size);
+
+    unsigned int bot_count = std::stoul(configuration.get_value("bots", "count").value_or("128"));
+    // NOTE: zero runs until killed
+    double run_for_seconds = std::stod(configuration.get_value("bots", "run_for_seconds").value_or("0"));
+    double report_every_seconds = std::stod(configuration.get_value("bots", "report_every_seconds").value_or("5"));
+
+    // NOTE: applied by each bot to its own connection, see network_sim
+    NetworkSimSettings network_sim_settings = network_sim_settings_from_configuration(configuration);
+
+    // NOTE: each bot gets its own connection, bots and networks refer to each other and so can't be moved around,
+    // hence the pointers
+    std::vector<std::unique_ptr<Network>> networks;
+    std::vector<std::unique_ptr<ClientTransport>> backend_transports;
+    std::vector<std::unique_ptr<SimulatedClientTransport>> simulated_transports;
+    std::vector<std::unique_ptr<BotSession>> bots;
+    // NOTE: has to match the server's backend, see UdpServerTransport
+    bool use_udp_backend = configuration.get_value("network", "backend") == "udp";
+    for (unsigned int bot_index = 0; bot_index < bot_count; bot_index++) {
+#ifdef __linux__
+        if (use_udp_backend) {
+            auto udp_transport = std::make_unique<UdpClientTransport>(ip_address, 7777);
+            if (not udp_transport->initialize_network()) {
+                global_logger.error("couldn't set up the udp backend of bot {} to {}:7777", bot_index, ip_address);
+                return 1;
+            }
+            udp_transport->attempt_to_connect_to_server();
+            backend_transports.push_back(std::move(udp_transport));
+        }
+#endif
+        if (backend_transports.size() == bot_index) {
+            networks.push_back(std::make_unique<Network>(ip_address, 7777));
+            networks.back()->logger.disable_all_levels();
+            if (not networks.back()->initialize_network()) {
+                global_logger.error("couldn't set up the enet backend of bot {} to {}:7777", bot_index, ip_address);
+                return 1;
+            }
+            networks.back()->attempt_to_connect_to_server();
+            backend_transports.push_back(std::make_unique<NetworkClientTransport<Network>>(*networks.back()));
+        }
+        ClientTransport *transport = backend_transports.back().get();
+        if (network_sim_settings.enabled) {
+            // NOTE: every bot gets its own random stream so their packets aren't all dropped together
+            NetworkSimSettings bot_network_sim_settings = network_sim_settings;
+            bot_network_sim_settings.seed += 2 * bot_index;
+            simulated_transports.push_back(
+                std::make_unique<SimulatedClientTransport>(*transport, bot_network_sim_settings));
+            transport = simulated_transports.back().get();
+        }
+        bots.push_back(std::make_unique<BotSession>(bot_index, behaviour, *transport, mp));
+    }
+    global_logger.info("started {} bots against {}", bot_count, ip_address);
+
+    FixedFrequencyLoop ffl;
+
+    double elapsed_time = 0;
+    double time_since_last_report = 0;
+    BotStatistics totals_at_last_report;
+
+    std::function<void(double)> tick = [&](double dt) {
+        for (auto &bot : bots) {
+            bot->tick(dt);
+        }
+
+        elapsed_time += dt;
+        time_since_last_report += dt;
+        if (time_since_last_report < report_every_seconds) {
+            return;
+        }
+
+        BotStatistics totals;
+        unsigned int bots_in_game = 0;
+        for (const auto &bot : bots) {
+            totals += bot->get_statistics();
+            bots_in_game += bot->has_received_game_update();
+        }
+
+        // NOTE: rates are over the last report period, shots and hits are totals
+        double seconds = time_since_last_report;
+        std::string report = fmt::format(
+            "[{:.0f}s] bots in game: {}/{} | up: {:.1f} kB/s {:.0f} packets/s | down: {:.1f} kB/s {:.0f} packets/s | "
+            "game updates: {:.0f}/s ({} skipped, {} undecodable) | shots: {} hits: {} misses: {} | input latency: {:.1f} ms "
+            "avg {:.1f} ms max",
+            elapsed_time, bots_in_game, bot_count,
+            (totals.bytes_sent - totals_at_last_report.bytes_sent) / 1000.0 / seconds,
+            (totals.packets_sent - totals_at_last_report.packets_sent) / seconds,
+            (totals.bytes_received - totals_at_last_report.bytes_received) / 1000.0 / seconds,
+            (totals.packets_received - totals_at_last_report.packets_received) / seconds,
+            (totals.game_updates_received - totals_at_last_report.game_updates_received) / seconds,
+            totals.game_updates_skipped, totals.game_update_decode_failures, totals.shots_fired, totals.hits,
+            totals.misses,
+            totals.input_latency_samples > 0 ? 1000 * totals.input_latency_total / totals.input_latency_samples : 0.0,
+            1000 * totals.input_latency_max);
+
+        std::cout << report << std::endl;
+        global_logger.info("{}", report);
+
+        totals_at_last_report = totals;
+        time_since_last_report = 0;
+    };
+
+    std::function<bool()> term = [&]() { return run_for_seconds > 0 and elapsed_time >= run_for_seconds; };
+
+    ffl.start(tick, term);
+
+    return 0;
+}
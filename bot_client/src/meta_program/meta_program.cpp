@@ -0,0 +1,6 @@
+#include "meta_program.hpp"
+
+namespace meta_program {
+
+
+} // namespace meta_program
@@ -0,0 +1,2 @@
+#include "packet_types.hpp"
+
@@ -0,0 +1 @@
+#include "packets.hpp"
@@ -0,0 +1,333 @@
+#include "udp_transport.hpp"
+
+#ifdef __linux__
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "../../utility/logger/logger.hpp"
+
+namespace {
+
+// NOTE: datagrams are read and written this many at a time
+constexpr unsigned int batch_size = 64;
+// NOTE: nothing this game sends comes close, anything longer is truncated by
+// the kernel and dropped
+constexpr size_t max_datagram_size = 1500;
+constexpr int socket_buffer_size = 4 * 1024 * 1024;
+
+uint64_t address_key(const sockaddr_in &address) {
+  return (uint64_t(address.sin_addr.s_addr) << 16) | address.sin_port;
+}
+
+// NOTE: the receiving half of both transports, calls on_datagram for every
+// datagram waiting on the socket and returns how many system calls it took,
+// datagrams that didn't fit in max_datagram_size are only counted
+template <typename OnDatagram>
+uint64_t receive_all(int socket_fd, uint64_t &truncated_datagram_count,
+                     OnDatagram on_datagram) {
+  static thread_local std::vector<char> buffers(batch_size *
+                                               max_datagram_size);
+  sockaddr_in addresses[batch_size];
+  iovec iovecs[batch_size];
+  mmsghdr messages[batch_size];
+
+  uint64_t system_calls = 0;
+  while (true) {
+    for (unsigned int i = 0; i < batch_size; i++) {
+      iovecs[i] = {buffers.data() + i * max_datagram_size, max_datagram_size};
+      messages[i] = {};
+      messages[i].msg_hdr.msg_iov = &iovecs[i];
+      messages[i].msg_hdr.msg_iovlen = 1;
+      messages[i].msg_hdr.msg_name = &addresses[i];
+      messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+    }
+
+    int received =
+        recvmmsg(socket_fd, messages, batch_size, MSG_DONTWAIT, nullptr);
+    system_calls++;
+    if (received <= 0) {
+      if (received < 0 and errno != EAGAIN and errno != EWOULDBLOCK) {
+        global_logger.warn("recvmmsg failed: {}", std::strerror(errno));
+      }
+      break;
+    }
+    for (int i = 0; i < received; i++) {
+      if (messages[i].msg_hdr.msg_flags & MSG_TRUNC) {
+        truncated_datagram_count++;
+        continue;
+      }
+      on_datagram(addresses[i], iovecs[i].iov_base, messages[i].msg_len);
+    }
+    if (received < int(batch_size)) {
+      break;
+    }
+  }
+  return system_calls;
+}
+
+bool set_socket_buffer_sizes(int socket_fd) {
+  return setsockopt(socket_fd, SOL_SOCKET, SO_RCVBUF, &socket_buffer_size,
+                    sizeof(socket_buffer_size)) == 0 and
+         setsockopt(socket_fd, SOL_SOCKET, SO_SNDBUF, &socket_buffer_size,
+                    sizeof(socket_buffer_size)) == 0;
+}
+
+} // namespace
+
+UdpServerTransport::UdpServerTransport(uint16_t port,
+                                       double client_timeout_seconds)
+    : port(port), client_timeout(client_timeout_seconds) {}
+
+UdpServerTransport::~UdpServerTransport() {
+  if (socket_fd >= 0) {
+    close(socket_fd);
+  }
+}
+
+bool UdpServerTransport::initialize_network() {
+  socket_fd = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+  if (socket_fd < 0) {
+    global_logger.warn("couldn't create a udp socket: {}", std::strerror(errno));
+    return false;
+  }
+  if (not set_socket_buffer_sizes(socket_fd)) {
+    // NOTE: not fatal, the defaults are just more likely to drop a burst
+    global_logger.warn("couldn't grow the udp socket buffers: {}",
+                       std::strerror(errno));
+  }
+
+  sockaddr_in address{};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_ANY);
+  address.sin_port = htons(port);
+  if (bind(socket_fd, reinterpret_cast<sockaddr *>(&address),
+           sizeof(address)) != 0) {
+    global_logger.warn("couldn't bind the udp socket to port {}: {}", port,
+                       std::strerror(errno));
+    close(socket_fd);
+    socket_fd = -1;
+    return false;
+  }
+  return true;
+}
+
+std::vector<PacketWithSize>
+UdpServerTransport::get_network_events_since_last_tick() {
+  std::vector<PacketWithSize> packets;
+  for (ReceivedPacket &received : get_received_packets_since_last_tick()) {
+    packets.push_back(std::move(received.packet));
+  }
+  return packets;
+}
+
+std::vector<ReceivedPacket>
+UdpServerTransport::get_received_packets_since_last_tick() {
+  std::vector<ReceivedPacket> packets;
+  if (socket_fd < 0) {
+    return packets;
+  }
+
+  auto now = std::chrono::steady_clock::now();
+  receive_system_call_count += receive_all(
+      socket_fd, truncated_datagram_count,
+      [&](const sockaddr_in &address, const void *data, size_t size) {
+        uint64_t key = address_key(address);
+        auto known = address_to_client_id.find(key);
+        if (known == address_to_client_id.end()) {
+          unsigned int client_id = next_client_id++;
+          known = address_to_client_id.emplace(key, client_id).first;
+          client_id_to_client[client_id] = {address, now};
+          global_logger.info("udp client {} connected from {}:{}", client_id,
+                             inet_ntoa(address.sin_addr),
+                             ntohs(address.sin_port));
+        }
+        client_id_to_client[known->second].last_heard_from = now;
+
+        // NOTE: empty datagrams only say hello
+        if (size == 0) {
+          return;
+        }
+        ReceivedPacket received;
+        received.packet.data.assign(static_cast<const char *>(data),
+                                    static_cast<const char *>(data) + size);
+        received.packet.size = size;
+        received.received_at = now;
+        received.sender_client_id = known->second;
+        packets.push_back(std::move(received));
+      });
+
+  forget_silent_clients();
+  return packets;
+}
+
+void UdpServerTransport::forget_silent_clients() {
+  auto now = std::chrono::steady_clock::now();
+  for (auto it = client_id_to_client.begin();
+       it != client_id_to_client.end();) {
+    if (now - it->second.last_heard_from > client_timeout) {
+      global_logger.info("udp client {} timed out", it->first);
+      address_to_client_id.erase(address_key(it->second.address));
+      it = client_id_to_client.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void UdpServerTransport::unreliable_send(unsigned int client_id,
+                                         const void *data, size_t size) {
+  auto client = client_id_to_client.find(client_id);
+  if (client == client_id_to_client.end()) {
+    return;
+  }
+  OutgoingDatagram datagram;
+  datagram.address = client->second.address;
+  datagram.data.assign(static_cast<const char *>(data),
+                       static_cast<const char *>(data) + size);
+  outgoing.push_back(std::move(datagram));
+}
+
+std::vector<unsigned int> UdpServerTransport::get_connected_client_ids() {
+  std::vector<unsigned int> client_ids;
+  client_ids.reserve(client_id_to_client.size());
+  for (const auto &[client_id, client] : client_id_to_client) {
+    client_ids.push_back(client_id);
+  }
+  return client_ids;
+}
+
+void UdpServerTransport::flush() {
+  if (socket_fd < 0 or outgoing.empty()) {
+    outgoing.clear();
+    return;
+  }
+
+  std::vector<iovec> iovecs(outgoing.size());
+  std::vector<mmsghdr> messages(outgoing.size());
+  for (size_t i = 0; i < outgoing.size(); i++) {
+    iovecs[i] = {outgoing[i].data.data(), outgoing[i].data.size()};
+    messages[i] = {};
+    messages[i].msg_hdr.msg_iov = &iovecs[i];
+    messages[i].msg_hdr.msg_iovlen = 1;
+    messages[i].msg_hdr.msg_name = &outgoing[i].address;
+    messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+  }
+
+  // NOTE: the kernel takes at most UIO_MAXIOV messages per call and may take
+  // fewer than it was given, whatever it refuses outright is dropped, as it
+  // would be by a full network
+  size_t sent = 0;
+  while (sent < messages.size()) {
+    unsigned int count = std::min<size_t>(messages.size() - sent, UIO_MAXIOV);
+    int result = sendmmsg(socket_fd, messages.data() + sent, count, 0);
+    send_system_call_count++;
+    if (result <= 0) {
+      global_logger.warn("sendmmsg failed, dropping {} datagrams: {}",
+                         messages.size() - sent, std::strerror(errno));
+      break;
+    }
+    sent += result;
+  }
+  outgoing.clear();
+}
+
+UdpClientTransport::UdpClientTransport(const std::string &server_host,
+                                       uint16_t port)
+    : server_host(server_host), port(port) {}
+
+UdpClientTransport::~UdpClientTransport() {
+  if (socket_fd >= 0) {
+    close(socket_fd);
+  }
+}
+
+bool UdpClientTransport::initialize_network() {
+  addrinfo hints{};
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_DGRAM;
+  addrinfo *result = nullptr;
+  int error = getaddrinfo(server_host.c_str(), std::to_string(port).c_str(),
+                          &hints, &result);
+  if (error != 0) {
+    global_logger.warn("couldn't resolve {}: {}", server_host,
+                       gai_strerror(error));
+    return false;
+  }
+
+  socket_fd = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+  // NOTE: connecting a udp socket only fixes who it talks to, so datagrams
+  // from anyone else are filtered out by the kernel
+  bool ok = socket_fd >= 0 and
+            connect(socket_fd, result->ai_addr, result->ai_addrlen) == 0;
+  freeaddrinfo(result);
+  if (not ok) {
+    global_logger.warn("couldn't set up a udp socket to {}:{}: {}",
+                       server_host, port, std::strerror(errno));
+    if (socket_fd >= 0) {
+      close(socket_fd);
+      socket_fd = -1;
+    }
+    return false;
+  }
+  set_socket_buffer_sizes(socket_fd);
+  return true;
+}
+
+void UdpClientTransport::attempt_to_connect_to_server() {
+  connecting = true;
+  send_hello();
+}
+
+void UdpClientTransport::send_hello() {
+  if (socket_fd >= 0) {
+    send(socket_fd, nullptr, 0, 0);
+  }
+  last_sent = std::chrono::steady_clock::now();
+}
+
+std::vector<PacketWithSize>
+UdpClientTransport::get_network_events_received_since_last_tick() {
+  std::vector<PacketWithSize> packets;
+  if (socket_fd < 0) {
+    return packets;
+  }
+
+  receive_all(socket_fd, truncated_datagram_count,
+              [&](const sockaddr_in &, const void *data, size_t size) {
+                heard_from_server = true;
+                PacketWithSize packet;
+                packet.data.assign(static_cast<const char *>(data),
+                                   static_cast<const char *>(data) + size);
+                packet.size = size;
+                packets.push_back(std::move(packet));
+              });
+
+  // NOTE: hello is repeated quickly until the server answers, after that it
+  // is only sent when we'd otherwise be silent long enough to be forgotten
+  auto since_last_sent = std::chrono::steady_clock::now() - last_sent;
+  if (connecting and
+      since_last_sent > (heard_from_server ? std::chrono::milliseconds(1000)
+                                           : std::chrono::milliseconds(250))) {
+    send_hello();
+  }
+  return packets;
+}
+
+void UdpClientTransport::send_packet(const void *data, size_t size) {
+  // NOTE: a client sends a packet or two a tick, so there is nothing to batch
+  if (socket_fd >= 0 and send(socket_fd, data, size, 0) < 0 and
+      errno != EAGAIN and errno != EWOULDBLOCK) {
+    global_logger.warn("udp send failed: {}", std::strerror(errno));
+  }
+  last_sent = std::chrono::steady_clock::now();
+}
+
+#endif // __linux__
@@ -0,0 +1,15 @@
+#ifndef SOUND_TYPES_HPP
+#define SOUND_TYPES_HPP
+
+// Enum representing different sound types
+enum class SoundType {
+  CLIENT_HIT,
+  CLIENT_MISS,
+  SERVER_HIT,
+  SERVER_MISS,
+  UI_HOVER,
+  UI_CLICK,
+  UI_SUCCESS,
+};
+
+#endif // SOUND_TYPES_HPP
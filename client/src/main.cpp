@@ -43,12 +43,22 @@
 #include "system_logic/physics/physics.hpp"
 #include "system_logic/mouse_update_logger/mouse_update_logger.hpp"
 #include "system_logic/hitscan_logic/hitscan_logic.hpp"
+#include "system_logic/rewind_history/rewind_history.hpp"
+#include "system_logic/sequence_buffer/sequence_buffer.hpp"
+#include "system_logic/jitter_buffer/jitter_buffer.hpp"
+#include "system_logic/hermite_interpolation/hermite_interpolation.hpp"
 
 #include "networking/client_networking/network.hpp"
+#include "networking/transport/transport.hpp"
+#include "networking/network_sim/network_sim.hpp"
+#include "networking/udp_transport/udp_transport.hpp"
+#include "networking/wire_format/wire_format.hpp"
 #include "networking/packet_handler/packet_handler.hpp"
 #include "networking/packets/packets.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <memory>
 #include <format>
 
 glm::vec2 get_ndc_mouse_pos1(GLFWwindow *window, double xpos, double ypos) {
@@ -231,11 +241,51 @@ int main() {
         vertex_geometry::generate_cylinder(8, physics.character_height_standing, physics.character_radius),
         colors::purple);
 
+    // NOTE: when on mouse updates are sent bit packed, see wire_format for the precision that costs
+    bool send_quantized_packets = tbx_engine.configuration.get_value("network", "quantized_packets") == "on";
+    // NOTE: when above one each mouse update is sent along with the ones before it that the server hasn't acknowledged
+    // yet (up to this many in total), so a lost packet doesn't lose its input or its shot, see MOUSE_UPDATE_WINDOW
+    size_t mouse_update_window_size = std::clamp<size_t>(
+        std::stoul(tbx_engine.configuration.get_value("network", "mouse_update_window").value_or("1")), 1,
+        wire_format::quantization::max_mouse_update_window_size);
+
     std::string ip_address = tbx_engine.configuration.get_value("network", "server_ip").value_or("localhost");
-    Network network(ip_address, 7777);
-    network.logger.disable_all_levels();
-    network.initialize_network();
-    network.attempt_to_connect_to_server();
+    // NOTE: has to match the server's backend, see UdpServerTransport
+    std::unique_ptr<Network> network;
+    std::unique_ptr<ClientTransport> backend_transport;
+    bool use_udp_backend = tbx_engine.configuration.get_value("network", "backend") == "udp";
+#ifdef __linux__
+    if (use_udp_backend) {
+        auto udp_transport = std::make_unique<UdpClientTransport>(ip_address, 7777);
+        if (not udp_transport->initialize_network()) {
+            global_logger.error("couldn't set up the udp backend to {}:7777", ip_address);
+            return 1;
+        }
+        udp_transport->attempt_to_connect_to_server();
+        backend_transport = std::move(udp_transport);
+    }
+#else
+    if (use_udp_backend) {
+        global_logger.warn("the udp backend is only available on linux, using enet");
+    }
+#endif
+    if (not backend_transport) {
+        network = std::make_unique<Network>(ip_address, 7777);
+        network->logger.disable_all_levels();
+        if (not network->initialize_network()) {
+            global_logger.error("couldn't set up the enet backend to {}:7777", ip_address);
+            return 1;
+        }
+        network->attempt_to_connect_to_server();
+        backend_transport = std::make_unique<NetworkClientTransport<Network>>(*network);
+    }
+
+    // NOTE: when [network_sim] is enabled packets are delayed, dropped, duplicated and reordered on their way in and
+    // out, for testing against a bad connection without a remote server
+    NetworkSimSettings network_sim_settings = network_sim_settings_from_configuration(tbx_engine.configuration);
+    SimulatedClientTransport simulated_transport(*backend_transport, network_sim_settings);
+    ClientTransport &transport = network_sim_settings.enabled ? static_cast<ClientTransport &>(simulated_transport)
+                                                              : *backend_transport;
 
     float room_size = 16.0f;
 
@@ -251,8 +301,20 @@ int main() {
         double y_pos;
     };
 
-    std::vector<LabelledMousePos> mouse_pos_history;
-    std::vector<GameUpdate> recent_game_updates_for_entity_interpolation;
+    unsigned int mouse_pos_update_number = 0;
+    // NOTE: keyed by mouse_pos_update_number, the ones the server has processed are dropped off the front as game
+    // updates come in, comfortably more than a second of samples at a high frame rate fit
+    SequenceBuffer<LabelledMousePos> mouse_pos_history(1024);
+    // NOTE: oldest first, the server tells us which ones it has processed through the game updates
+    std::vector<MouseUpdate> unacknowledged_mouse_updates;
+    bool has_sent_a_mouse_update = false;
+    unsigned int last_sent_mouse_pos_update_number = 0;
+    // NOTE: the number the next mouse sample will get at the moment fire was pressed
+    unsigned int mouse_pos_update_number_when_fire_pressed = 0;
+    // NOTE: game updates are drawn from here a playout delay behind the server, which follows how much their arrival
+    // times jitter, see JitterBuffer
+    JitterBuffer<GameUpdate> game_update_jitter_buffer(JitterBuffer<GameUpdate>::Settings{});
+    SimulationClock jitter_buffer_clock = real_time_clock();
 
     // NOTE: the value of this is different depending on if entity_interoplation is on, when it's on this is delayed by
     // one or two due to us requiring two game updates to do entity interpolation
@@ -267,17 +329,51 @@ int main() {
 
     Stopwatch game_update_received;
 
-    std::function<void(std::vector<uint8_t>)> game_update_handler = [&](std::vector<uint8_t> raw_packet) {
-        LogSection _(global_logger, "game update handler");
+    // NOTE: every game update we receive is kept around for a while so that delta game updates can be decoded against
+    // it, the newest one is acknowledged in each mouse update so the server knows which ones we have
+    RewindHistory<GameUpdate> update_number_to_received_game_update(128);
+    bool has_received_game_update = false;
+    unsigned int last_received_game_update_number = 0;
 
-        GameUpdatePacket packet = mp.deserialize_GameUpdatePacket(raw_packet);
+    // NOTE: the server tells us our id through the game updates it sends us, see MouseUpdate
+    unsigned int client_id = 0;
 
-        GameUpdate just_received_game_update = packet.game_update;
-
-        global_logger.info("just received game update packet: {}", mp.GameUpdatePacket_to_string(packet));
+    std::function<void(GameUpdate)> apply_game_update = [&](GameUpdate just_received_game_update) {
         game_update_received.press();
 
+        // NOTE: a reordered game update from before the history's window would take a newer one's slot
+        if (not update_number_to_received_game_update.is_older_than_rewind_window(
+                just_received_game_update.update_number)) {
+            update_number_to_received_game_update.record(just_received_game_update.update_number) =
+                just_received_game_update;
+        }
+        // NOTE: the network can reorder and duplicate game updates, one that isn't newer than what we have would snap
+        // the camera back to an old server angle and its mouse positions have already been discarded
+        bool is_stale = has_received_game_update and
+                        just_received_game_update.update_number <= last_received_game_update_number;
+        if (not is_stale) {
+            has_received_game_update = true;
+            last_received_game_update_number = just_received_game_update.update_number;
+            client_id = just_received_game_update.client_id;
+        }
+
         global_logger.debug("just received game update, receiving at rate {}", game_update_received.average_frequency);
+
+        if (entity_interpolation) {
+            // NOTE: when using entity interpolation the game update goes into the jitter buffer even when it's stale,
+            // it still fills in a gap there, duplicates are ignored there
+            game_update_jitter_buffer.insert(just_received_game_update.update_number, just_received_game_update,
+                                             jitter_buffer_clock());
+            global_logger.debug("just added game update to the jitter buffer, target playout delay is now: {}",
+                                game_update_jitter_buffer.get_target_playout_delay());
+        }
+
+        if (is_stale) {
+            global_logger.debug("game update {} is not newer than {}, not reconciling against it",
+                                just_received_game_update.update_number, last_received_game_update_number);
+            return;
+        }
+
         global_logger.debug("last processed mouse update: {}",
                             just_received_game_update.last_processed_mouse_pos_update_number);
 
@@ -305,35 +401,34 @@ int main() {
             last_applied_game_update_number_entity_interpolation = just_received_game_update.update_number;
 
             global_logger.debug("just updated the targets position to: {}", vec3_to_string(new_target_pos));
-        } else {
-
-            // NOTE: when using entity interpolation we push back the game update to the vector
-            recent_game_updates_for_entity_interpolation.push_back(just_received_game_update);
-            global_logger.debug("just added game update to recently received game updates, size is now: {}",
-                                recent_game_updates_for_entity_interpolation.size());
         }
 
         // NOTE: we don't ever need to use updates that came before
-        std::erase_if(mouse_pos_history, [&](const auto &lmp) {
-            return lmp.mouse_pos_update_number < just_received_game_update.last_processed_mouse_pos_update_number;
+        unsigned int last_processed_mouse_pos_update_number =
+            just_received_game_update.last_processed_mouse_pos_update_number;
+        mouse_pos_history.discard_before(last_processed_mouse_pos_update_number);
+        std::erase_if(unacknowledged_mouse_updates, [&](const MouseUpdate &mu) {
+            return mu.mouse_pos_update_number <= just_received_game_update.last_processed_mouse_pos_update_number;
         });
 
         global_logger.start_section("reconciliation");
         global_logger.debug("before reconciling our client simulated angles were yaw: {} pitch: {} ", predicted_yaw,
                             predicted_pitch);
-        for (const auto &lmp : mouse_pos_history) {
-            if (lmp.mouse_pos_update_number == just_received_game_update.last_processed_mouse_pos_update_number) {
-                global_logger.debug("set mouse position to the last processed one on the server: ({}, {})", lmp.x_pos,
-                                    lmp.y_pos);
-                tbx_engine.fps_camera.mouse.last_mouse_position_x = lmp.x_pos;
-                tbx_engine.fps_camera.mouse.last_mouse_position_y = lmp.y_pos;
-            } else if (lmp.mouse_pos_update_number > just_received_game_update.last_processed_mouse_pos_update_number) {
-                global_logger.debug("reapplying mouse position: ({}, {})", lmp.x_pos, lmp.y_pos);
-                tbx_engine.fps_camera.mouse_callback(lmp.x_pos, lmp.y_pos);
-                global_logger.debug("resulting in yaw pitch: ({}, {})",
-                                    tbx_engine.fps_camera.transform.get_rotation_yaw(),
-                                    tbx_engine.fps_camera.transform.get_rotation_pitch());
-            }
+        if (const LabelledMousePos *lmp = mouse_pos_history.get(last_processed_mouse_pos_update_number)) {
+            global_logger.debug("set mouse position to the last processed one on the server: ({}, {})", lmp->x_pos,
+                                lmp->y_pos);
+            tbx_engine.fps_camera.mouse.last_mouse_position_x = lmp->x_pos;
+            tbx_engine.fps_camera.mouse.last_mouse_position_y = lmp->y_pos;
+        }
+        // NOTE: only the unacknowledged tail is walked
+        for (unsigned int n = std::max(last_processed_mouse_pos_update_number + 1,
+                                       mouse_pos_history.get_first_sequence_number());
+             n < mouse_pos_history.get_end_sequence_number(); n++) {
+            const LabelledMousePos &lmp = mouse_pos_history[n];
+            global_logger.debug("reapplying mouse position: ({}, {})", lmp.x_pos, lmp.y_pos);
+            tbx_engine.fps_camera.mouse_callback(lmp.x_pos, lmp.y_pos);
+            global_logger.debug("resulting in yaw pitch: ({}, {})", tbx_engine.fps_camera.transform.get_rotation_yaw(),
+                                tbx_engine.fps_camera.transform.get_rotation_pitch());
         }
         global_logger.end_section("reconciliation");
 
@@ -344,12 +439,69 @@ int main() {
                             reconciled_pitch - predicted_pitch);
     };
 
+    std::function<void(std::vector<uint8_t>)> game_update_handler = [&](std::vector<uint8_t> raw_packet) {
+        LogSection _(global_logger, "game update handler");
+
+        GameUpdatePacket packet;
+        if (not wire_format::deserialize(std::span<const uint8_t>(raw_packet), packet)) {
+            global_logger.warn("dropping game update packet, only received {} bytes", raw_packet.size());
+            return;
+        }
+
+        global_logger.info("just received game update packet: {}", mp.GameUpdatePacket_to_string(packet));
+        apply_game_update(packet.game_update);
+    };
+
     packet_handler.register_handler(PacketType::GAME_UPDATE, game_update_handler);
 
+    std::function<void(std::vector<uint8_t>)> quantized_game_update_handler = [&](std::vector<uint8_t> raw_packet) {
+        LogSection _(global_logger, "quantized game update handler");
+
+        GameUpdate just_received_game_update;
+        wire_format::ByteReader reader(raw_packet);
+        if (not wire_format::deserialize_quantized(reader, just_received_game_update, last_received_game_update_number,
+                                                   mouse_pos_update_number)) {
+            global_logger.warn("dropping quantized game update packet, only received {} bytes", raw_packet.size());
+            return;
+        }
+
+        global_logger.info("just received quantized game update: {}",
+                           mp.GameUpdate_to_string(just_received_game_update));
+        apply_game_update(just_received_game_update);
+    };
+
+    packet_handler.register_handler(PacketType::GAME_UPDATE_QUANTIZED, quantized_game_update_handler);
+
+    std::function<void(std::vector<uint8_t>)> delta_game_update_handler = [&](std::vector<uint8_t> raw_packet) {
+        LogSection _(global_logger, "delta game update handler");
+
+        GameUpdate just_received_game_update;
+        wire_format::ByteReader reader(raw_packet);
+        auto get_baseline = [&](unsigned int baseline_update_number) -> const GameUpdate * {
+            return update_number_to_received_game_update.get(baseline_update_number);
+        };
+        if (not wire_format::deserialize_delta(reader, just_received_game_update, last_received_game_update_number,
+                                               mouse_pos_update_number, get_baseline)) {
+            global_logger.warn("dropping delta game update packet of {} bytes, it was truncated or its baseline is "
+                               "no longer in our history",
+                               raw_packet.size());
+            return;
+        }
+
+        global_logger.info("just received delta game update: {}", mp.GameUpdate_to_string(just_received_game_update));
+        apply_game_update(just_received_game_update);
+    };
+
+    packet_handler.register_handler(PacketType::GAME_UPDATE_DELTA, delta_game_update_handler);
+
     std::function<void(std::vector<uint8_t>)> sound_update_handler = [&](std::vector<uint8_t> raw_packet) {
         LogSection _(global_logger, "sound update handler");
 
-        SoundUpdatePacket packet = mp.deserialize_SoundUpdatePacket(raw_packet);
+        SoundUpdatePacket packet;
+        if (not wire_format::deserialize(std::span<const uint8_t>(raw_packet), packet)) {
+            global_logger.warn("dropping sound update packet, only received {} bytes", raw_packet.size());
+            return;
+        }
         SoundUpdate just_received_sound_update = packet.sound_update;
 
         global_logger.info("just received sound update packet: {}", mp.SoundUpdatePacket_to_string(packet));
@@ -359,7 +511,22 @@ int main() {
 
     packet_handler.register_handler(PacketType::SOUND_UPDATE, sound_update_handler);
 
-    unsigned int mouse_pos_update_number = 0;
+    // NOTE: the packets in a frame are handed to the handlers above in the order the server wrote them, so the sounds
+    // of a tick are played once the game update they go with has been applied
+    std::function<void(std::vector<uint8_t>)> game_frame_handler = [&](std::vector<uint8_t> raw_packet) {
+        LogSection _(global_logger, "game frame handler");
+
+        std::vector<PacketWithSize> packets_in_frame;
+        if (not wire_format::split_game_frame(raw_packet, packets_in_frame)) {
+            global_logger.warn("dropping game frame of {} bytes, it was truncated", raw_packet.size());
+            return;
+        }
+
+        global_logger.info("just received game frame with {} packets", packets_in_frame.size());
+        packet_handler.handle_packets(packets_in_frame);
+    };
+
+    packet_handler.register_handler(PacketType::GAME_FRAME, game_frame_handler);
 
     std::function<void(double, double)> mouse_pos_callback = [&](double xpos, double ypos) {
         LogSection _(global_logger, "mouse pos callback");
@@ -386,9 +553,6 @@ int main() {
 
     PeriodicSignal send_mouse_updates_signal(60);
 
-    // NOTE: the phase will not be aligned but the rate will be the same.
-    PeriodicSignal mock_server_send_signal(60);
-
     // room [[
 
     std::vector<glm::vec3> cube_colors;
@@ -429,6 +593,7 @@ int main() {
     bool fire_pressed_since_last_send = false;
     bool fire_pressed_since_last_send_prev = false;
     double subtick_percent_that_fire_occurred_at = 0;
+    double entity_extrapolation_when_fire_occurred = 0;
     double subtick_x_pos_before_firing = 0;
     double subtick_y_pos_before_firing = 0;
 
@@ -467,38 +632,108 @@ int main() {
                              last_applied_game_update_number_before_firing_camera_cpsr);
             }
 
-            if (not mouse_pos_history.empty()) {
+            // NOTE: until the first game update comes in we don't know our client id, so the server couldn't tell
+            // whose mouse updates these are
+            if (not mouse_pos_history.empty() and has_received_game_update) {
 
                 LogSection _(global_logger, "about to send the last mouse pos in history");
 
+                // NOTE: the server skips mouse updates it has already processed, so every send needs a number of its
+                // own, if the mouse hasn't moved since the last one its position is sent again under a new number, the
+                // same goes for a click that no mouse sample has come after yet, see below
+                bool mouse_moved_since_last_send = not has_sent_a_mouse_update or
+                                                   mouse_pos_history.back().mouse_pos_update_number !=
+                                                       last_sent_mouse_pos_update_number;
+                bool mouse_moved_since_fire_pressed =
+                    mouse_pos_history.back().mouse_pos_update_number >= mouse_pos_update_number_when_fire_pressed;
+                if (not mouse_moved_since_last_send or
+                    (fire_pressed_since_last_send and not mouse_moved_since_fire_pressed)) {
+                    LabelledMousePos unmoved_mouse_pos = mouse_pos_history.back();
+                    unmoved_mouse_pos.mouse_pos_update_number = mouse_pos_update_number;
+                    mouse_pos_history.push_back(unmoved_mouse_pos);
+                    mouse_pos_update_number += 1;
+                }
+
+                auto make_mouse_update = [&](const LabelledMousePos &lmp, bool fire_pressed) {
+                    return MouseUpdate(client_id, lmp.mouse_pos_update_number, has_received_game_update,
+                                       last_received_game_update_number,
+                                       last_applied_game_update_number_before_firing_entity_interpolation,
+                                       last_applied_game_update_number_before_firing_camera_cpsr,
+                                       subtick_percent_that_fire_occurred_at, entity_extrapolation_when_fire_occurred,
+                                       subtick_x_pos_before_firing, subtick_y_pos_before_firing, lmp.x_pos,
+                                       lmp.y_pos, fire_pressed, tbx_engine.fps_camera.active_sensitivity);
+                };
+
                 auto last_mouse_pos = mouse_pos_history.back();
 
                 global_logger.debug("sending out mouse pos [{}]: ({}, {})", last_mouse_pos.mouse_pos_update_number,
                                     last_mouse_pos.x_pos, last_mouse_pos.y_pos);
-                MouseUpdate mu(last_mouse_pos.mouse_pos_update_number,
-                               last_applied_game_update_number_before_firing_entity_interpolation,
-                               last_applied_game_update_number_before_firing_camera_cpsr,
-                               subtick_percent_that_fire_occurred_at, subtick_x_pos_before_firing,
-                               subtick_y_pos_before_firing, last_mouse_pos.x_pos, last_mouse_pos.y_pos,
-                               fire_pressed_since_last_send, // NOTE: we use this instead of sampling the keyboard now.
-                               tbx_engine.fps_camera.active_sensitivity);
-
-                MouseUpdatePacket mup;
-                mup.header.type = PacketType::MOUSE_UPDATE;
-                mup.header.size_of_data_without_header = mp.size_when_serialized_MouseUpdate(mu);
-                mup.mouse_update = mu;
-
-                auto buffer = mp.serialize_MouseUpdatePacket(mup);
-
-                network.send_packet(buffer.data(), buffer.size());
-
-                global_logger.info("just sent mouse update packet: {}", mp.MouseUpdatePacket_to_string(mup));
+                // NOTE: we use fire_pressed_since_last_send instead of sampling the keyboard now.
+                MouseUpdate mu = make_mouse_update(last_mouse_pos, fire_pressed_since_last_send);
+
+                if (mouse_update_window_size > 1) {
+                    // NOTE: with a window every mouse sample taken since the last send goes out rather than only the
+                    // latest, so the server's camera follows the exact path ours did, the click goes on the first
+                    // sample taken after it, which lets the server walk the path right up to the click when it
+                    // rebuilds our view for the shot
+                    bool fire_pressed_sample_added = false;
+                    unsigned int first_unsent_mouse_pos_update_number =
+                        has_sent_a_mouse_update ? std::max(last_sent_mouse_pos_update_number + 1,
+                                                           mouse_pos_history.get_first_sequence_number())
+                                                : mouse_pos_history.get_first_sequence_number();
+                    for (unsigned int n = first_unsent_mouse_pos_update_number;
+                         n < mouse_pos_history.get_end_sequence_number(); n++) {
+                        const LabelledMousePos &lmp = mouse_pos_history[n];
+                        bool fire_pressed = fire_pressed_since_last_send and not fire_pressed_sample_added and
+                                            lmp.mouse_pos_update_number >= mouse_pos_update_number_when_fire_pressed;
+                        fire_pressed_sample_added = fire_pressed_sample_added or fire_pressed;
+                        unacknowledged_mouse_updates.push_back(make_mouse_update(lmp, fire_pressed));
+                    }
+                    if (unacknowledged_mouse_updates.size() > mouse_update_window_size) {
+                        unacknowledged_mouse_updates.erase(unacknowledged_mouse_updates.begin(),
+                                                           unacknowledged_mouse_updates.end() -
+                                                               mouse_update_window_size);
+                    }
+
+                    std::array<uint8_t, wire_format::max_size_when_mouse_update_window> buffer;
+                    wire_format::ByteWriter writer(buffer);
+                    wire_format::serialize_mouse_update_window(unacknowledged_mouse_updates, writer);
+
+                    transport.send_packet(buffer.data(), writer.get_bytes_written());
+
+                    global_logger.info("just sent mouse update window of {} mouse updates ending with: {}",
+                                       unacknowledged_mouse_updates.size(),
+                                       mp.MouseUpdate_to_string(unacknowledged_mouse_updates.back()));
+                } else if (send_quantized_packets) {
+                    std::array<uint8_t, wire_format::max_size_when_quantized_mouse_update> buffer;
+                    wire_format::ByteWriter writer(buffer);
+                    wire_format::serialize_quantized(mu, writer);
+
+                    transport.send_packet(buffer.data(), writer.get_bytes_written());
+
+                    global_logger.info("just sent quantized mouse update: {}", mp.MouseUpdate_to_string(mu));
+                } else {
+                    MouseUpdatePacket mup;
+                    mup.header.type = PacketType::MOUSE_UPDATE;
+                    mup.header.size_of_data_without_header = wire_format::size_when_serialized<MouseUpdate>;
+                    mup.mouse_update = mu;
+
+                    wire_format::FixedSizeBuffer<MouseUpdatePacket> buffer;
+                    wire_format::ByteWriter writer(buffer);
+                    wire_format::serialize(mup, writer);
+
+                    transport.send_packet(buffer.data(), buffer.size());
+
+                    global_logger.info("just sent mouse update packet: {}", mp.MouseUpdatePacket_to_string(mup));
+                }
+                has_sent_a_mouse_update = true;
+                last_sent_mouse_pos_update_number = last_mouse_pos.mouse_pos_update_number;
             }
             fire_pressed_since_last_send_prev = fire_pressed_since_last_send;
             fire_pressed_since_last_send = false;
         }
 
-        std::vector<PacketWithSize> pws = network.get_network_events_received_since_last_tick();
+        std::vector<PacketWithSize> pws = transport.get_network_events_received_since_last_tick();
         packet_handler.handle_packets(pws);
 
         // target.transform.set_translation();
@@ -527,14 +762,19 @@ int main() {
             //                                                          tbx_engine.configuration, dt);
         }
 
-        auto percentage_through_cycle = mock_server_send_signal.get_cycle_progress();
+        // NOTE: how far the target we're drawing is past the game update it was drawn from, without entity
+        // interpolation the game update is drawn as is, when we ran out of game updates it was dead reckoned for
+        // entity_extrapolation seconds past it instead
+        float percentage_through_cycle = 0;
+        float entity_extrapolation = 0;
 
         if (entity_interpolation) {
-            if (recent_game_updates_for_entity_interpolation.size() >= 2) {
+            auto playout = game_update_jitter_buffer.get_playout(jitter_buffer_clock());
+            if (playout.available) {
                 LogSection _(global_logger, "entity interpolation");
 
-                auto start_game_update = recent_game_updates_for_entity_interpolation.at(0);
-                auto end_game_update = recent_game_updates_for_entity_interpolation.at(1);
+                const GameUpdate &start_game_update = *playout.start_snapshot;
+                const GameUpdate &end_game_update = *playout.end_snapshot;
 
                 auto start_position = glm::vec3(start_game_update.target_x_pos, start_game_update.target_y_pos,
                                                 start_game_update.target_z_pos);
@@ -542,32 +782,45 @@ int main() {
                 auto end_position =
                     glm::vec3(end_game_update.target_x_pos, end_game_update.target_y_pos, end_game_update.target_z_pos);
 
+                auto start_velocity = glm::vec3(start_game_update.target_x_vel, start_game_update.target_y_vel,
+                                                start_game_update.target_z_vel);
+
+                auto end_velocity =
+                    glm::vec3(end_game_update.target_x_vel, end_game_update.target_y_vel, end_game_update.target_z_vel);
+
                 global_logger.debug(
                     "interpolating between game update {} with start position {} and game update {} with "
                     "end position {}",
                     start_game_update.update_number, vec3_to_string(start_position, 3), end_game_update.update_number,
                     vec3_to_string(end_position, 3));
 
-                float t = percentage_through_cycle;
+                float t = playout.fraction;
 
                 global_logger.debug("interpolation percent: {}", t);
 
-                auto interpolated_position = (1 - t) * start_position + t * end_position;
+                // NOTE: the target moves along an arc, following the velocities keeps us on it where a straight line
+                // between the two positions would cut inside, the server rewinds the same way
+                glm::vec3 interpolated_position;
+                if (playout.starved) {
+                    global_logger.debug("jitter buffer ran out of game updates, extrapolating {} s past the newest one",
+                                        playout.extrapolation);
+                    interpolated_position =
+                        extrapolate_position(start_position, start_velocity, playout.extrapolation);
+                } else {
+                    interpolated_position = hermite_interpolate(start_position, start_velocity, end_position,
+                                                                end_velocity, playout.duration, t);
+                }
 
                 global_logger.debug("interpolation position: {}", vec3_to_string(interpolated_position, 3));
 
                 physics_target->SetPosition(g2j(interpolated_position));
                 target.transform.set_translation(interpolated_position);
 
-                last_applied_game_update_number_entity_interpolation = start_game_update.update_number;
-
-                if (mock_server_send_signal.process_and_get_signal()) {
-                    global_logger.debug("mock server send signal activated");
-                    recent_game_updates_for_entity_interpolation.erase(
-                        recent_game_updates_for_entity_interpolation.begin());
-                    global_logger.debug("after erasing from start of game updates the size is: {}",
-                                        recent_game_updates_for_entity_interpolation.size());
-                }
+                // NOTE: the server has every tick so this can differ from the start game update when we're
+                // interpolating over one that never arrived
+                last_applied_game_update_number_entity_interpolation = playout.update_number;
+                percentage_through_cycle = playout.update_fraction;
+                entity_extrapolation = playout.starved ? playout.extrapolation : 0;
             }
         }
 
@@ -590,8 +843,10 @@ int main() {
                     last_applied_game_update_number_entity_interpolation;
                 last_applied_game_update_number_before_firing_camera_cpsr = last_applied_game_update_number_camera_cpsr;
                 subtick_percent_that_fire_occurred_at = percentage_through_cycle;
+                entity_extrapolation_when_fire_occurred = entity_extrapolation;
                 subtick_x_pos_before_firing = tbx_engine.fps_camera.mouse.last_mouse_position_x;
                 subtick_y_pos_before_firing = tbx_engine.fps_camera.mouse.last_mouse_position_y;
+                mouse_pos_update_number_when_fire_pressed = mouse_pos_update_number;
             }
 
             firing_logic(fire_just_occurred, tbx_engine, physics_target,
@@ -0,0 +1 @@
+#include "hermite_interpolation.hpp"
@@ -0,0 +1,259 @@
+#ifndef JITTER_BUFFER_HPP
+#define JITTER_BUFFER_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+
+#include "../rewind_history/rewind_history.hpp"
+
+// NOTE: holds the snapshots the server sends us (one per tick, numbered by its
+// update number) and decides which point on the server's timeline to draw
+// each frame. Every snapshot's arrival time is compared against when it would
+// have arrived over a jitter free connection, which is estimated from the
+// fastest arrival in a recent window, and the playout delay is the typical
+// lateness on top of that plus a few deviations, plus one tick so the snapshot
+// after the one being drawn is usually there already. The playout clock eases
+// towards that delay instead of jumping, so a burst of late snapshots grows
+// the delay and it shrinks back once the connection calms down. Snapshots are
+// keyed by update number so duplicates and reordering don't matter, a missing
+// snapshot is interpolated over from its neighbours and when we run out the
+// newest one is extrapolated from for a bounded amount of time.
+//
+// The playout position is reported as an update number and a fraction of the
+// way to the next one, which is what the server needs to rewind to what we
+// drew. When we have run out it is reported as the newest snapshot's update
+// number and how long past it we extrapolated instead, the server dead
+// reckons from that snapshot the same way rather than rewinding to the
+// extrapolated time on the true path.
+template <typename T> class JitterBuffer {
+public:
+  struct Settings {
+    double tick_rate = 60;
+    // NOTE: in seconds
+    double min_playout_delay = 0;
+    double max_playout_delay = 0.5;
+    // NOTE: how many deviations of lateness the delay covers
+    double deviation_multiplier = 4;
+    // NOTE: per snapshot, how much of the lateness estimate each arrival
+    // replaces
+    double lateness_smoothing = 1.0 / 32;
+    // NOTE: the fastest arrival is looked for over this many seconds, long
+    // enough to catch one that wasn't delayed, short enough to follow a route
+    // change
+    double fastest_arrival_window = 2;
+    // NOTE: the playout clock runs this much faster or slower than real time
+    // at most while it eases towards the target delay
+    double max_playout_rate_change = 0.1;
+    // NOTE: further off than this and the playout clock jumps instead, e.g.
+    // after a long stall
+    double max_playout_offset_error = 1;
+    // NOTE: how far past the newest snapshot we're willing to guess, in
+    // seconds, after that it's held where it is
+    double max_extrapolation = 0.1;
+  };
+
+  struct Playout {
+    // NOTE: false until there's a snapshot at or before the playout position
+    bool available = false;
+    // NOTE: draw start_snapshot blended fraction of the way to end_snapshot,
+    // these are the same snapshot when we have run out
+    const T *start_snapshot = nullptr;
+    const T *end_snapshot = nullptr;
+    float fraction = 0;
+    // NOTE: the time between the two snapshots in seconds
+    float duration = 0;
+    // NOTE: what to tell the server, the tick before the drawn position and
+    // how far past it we are, when starved the start snapshot's tick and a
+    // fraction of zero
+    unsigned int update_number = 0;
+    float update_fraction = 0;
+    // NOTE: true when there's nothing to interpolate towards yet, the start
+    // snapshot should then be extrapolated from for this many seconds, which
+    // has to be told to the server as well
+    bool starved = false;
+    float extrapolation = 0;
+  };
+
+  struct Statistics {
+    unsigned int received = 0;
+    unsigned int duplicates = 0;
+    // NOTE: arrived after the playout position had passed them, or too late to
+    // be kept at all
+    unsigned int late = 0;
+    unsigned int starved_frames = 0;
+  };
+
+  explicit JitterBuffer(Settings settings, unsigned int capacity = 128)
+      : settings(settings), tick_period(1 / settings.tick_rate),
+        update_number_to_snapshot(capacity) {}
+
+  // NOTE: time is in seconds on whatever clock is also passed to
+  // get_playout, returns false if the snapshot was already here or is older
+  // than capacity updates behind the newest one, it would take the newer
+  // one's slot
+  bool insert(unsigned int update_number, const T &snapshot, double time) {
+    if (update_number_to_snapshot.is_older_than_rewind_window(update_number)) {
+      statistics.late++;
+      return false;
+    }
+    if (update_number_to_snapshot.get(update_number) != nullptr) {
+      statistics.duplicates++;
+      return false;
+    }
+    statistics.received++;
+    if (has_started_playout and update_number + 1 <= playout_position) {
+      statistics.late++;
+    }
+    update_number_to_snapshot.record(update_number) = snapshot;
+
+    double transit = time - update_number * tick_period;
+    while (not recent_transits.empty() and
+           recent_transits.back().transit >= transit) {
+      recent_transits.pop_back();
+    }
+    recent_transits.push_back({time, transit});
+    while (recent_transits.front().time <
+           time - settings.fastest_arrival_window) {
+      recent_transits.pop_front();
+    }
+
+    double lateness = transit - recent_transits.front().transit;
+    if (not has_lateness_estimate) {
+      mean_lateness = lateness;
+      lateness_deviation = 0;
+      has_lateness_estimate = true;
+    } else {
+      double a = settings.lateness_smoothing;
+      lateness_deviation +=
+          a * (std::abs(lateness - mean_lateness) - lateness_deviation);
+      mean_lateness += a * (lateness - mean_lateness);
+    }
+    return true;
+  }
+
+  // NOTE: call once per frame with a time that never goes backwards
+  Playout get_playout(double time) {
+    Playout playout;
+    if (not has_lateness_estimate) {
+      return playout;
+    }
+
+    double target_offset =
+        recent_transits.front().transit + get_target_playout_delay();
+    if (not has_started_playout or
+        std::abs(target_offset - playout_offset) >
+            settings.max_playout_offset_error) {
+      playout_offset = target_offset;
+      has_started_playout = true;
+    } else {
+      double max_change =
+          settings.max_playout_rate_change * (time - last_playout_time);
+      playout_offset += std::clamp(target_offset - playout_offset, -max_change,
+                                   max_change);
+    }
+    last_playout_time = time;
+    playout_position = std::max(playout_position,
+                                (time - playout_offset) / tick_period);
+
+    unsigned int newest = update_number_to_snapshot.get_latest_update_number();
+    unsigned int oldest =
+        newest -
+        std::min(newest, update_number_to_snapshot.get_max_rewind_ticks());
+    if (playout_position < oldest) {
+      return playout;
+    }
+
+    // NOTE: the newest snapshot at or before the playout position, there can
+    // be gaps so it might be a few back
+    unsigned int start =
+        std::min(newest, static_cast<unsigned int>(playout_position));
+    while (start > oldest and update_number_to_snapshot.get(start) == nullptr) {
+      start--;
+    }
+    const T *start_snapshot = update_number_to_snapshot.get(start);
+    if (start_snapshot == nullptr) {
+      return playout;
+    }
+
+    unsigned int end = start + 1;
+    while (end <= newest and update_number_to_snapshot.get(end) == nullptr) {
+      end++;
+    }
+
+    playout.available = true;
+    playout.start_snapshot = start_snapshot;
+    if (end > newest) {
+      statistics.starved_frames++;
+      playout.starved = true;
+      playout.end_snapshot = start_snapshot;
+      playout.extrapolation = static_cast<float>(
+          std::min((playout_position - start) * tick_period,
+                   settings.max_extrapolation));
+      playout.update_number = start;
+      playout.update_fraction = 0;
+      return playout;
+    }
+
+    playout.end_snapshot = update_number_to_snapshot.get(end);
+    playout.fraction = std::clamp(
+        static_cast<float>((playout_position - start) / (end - start)), 0.0f,
+        1.0f);
+    playout.duration = static_cast<float>((end - start) * tick_period);
+    // NOTE: the server has every tick so it can rewind to the playout position
+    // directly even when we're interpolating over a gap
+    playout.update_number = static_cast<unsigned int>(playout_position);
+    playout.update_fraction =
+        static_cast<float>(playout_position - playout.update_number);
+    return playout;
+  }
+
+  double get_target_playout_delay() const {
+    return std::clamp(tick_period + mean_lateness +
+                          settings.deviation_multiplier * lateness_deviation,
+                      settings.min_playout_delay, settings.max_playout_delay);
+  }
+
+  // NOTE: how far behind the newest snapshot's tick the playout position is,
+  // in seconds
+  double get_playout_delay() const {
+    return has_started_playout
+               ? (update_number_to_snapshot.get_latest_update_number() -
+                  playout_position) *
+                     tick_period
+               : 0;
+  }
+
+  double get_mean_lateness() const { return mean_lateness; }
+  double get_lateness_deviation() const { return lateness_deviation; }
+  const Statistics &get_statistics() const { return statistics; }
+
+private:
+  struct Transit {
+    double time;
+    double transit;
+  };
+
+  Settings settings;
+  double tick_period;
+  RewindHistory<T> update_number_to_snapshot;
+
+  // NOTE: arrival time minus the tick's time on the server, increasing so the
+  // front is the fastest arrival in the window
+  std::deque<Transit> recent_transits;
+  bool has_lateness_estimate = false;
+  double mean_lateness = 0;
+  double lateness_deviation = 0;
+
+  bool has_started_playout = false;
+  // NOTE: subtracted from the time to get the playout position in seconds on
+  // the server's timeline
+  double playout_offset = 0;
+  double last_playout_time = 0;
+  // NOTE: in ticks, never goes backwards
+  double playout_position = 0;
+
+  Statistics statistics;
+};
+
+#endif // JITTER_BUFFER_HPP
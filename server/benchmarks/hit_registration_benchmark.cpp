@@ -0,0 +1,450 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Physics/Collision/RayCast.h>
+#include <Jolt/Physics/Collision/Shape/Shape.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/constants.hpp>
+
+#include <fmt/core.h>
+
+#include "../src/meta_program/meta_program.hpp"
+#include "../src/networking/loopback_transport/loopback_transport.hpp"
+#include "../src/networking/packet_handler/packet_handler.hpp"
+#include "../src/networking/packets/packets.hpp"
+#include "../src/networking/wire_format/wire_format.hpp"
+
+#include "../src/graphics/fps_camera/fps_camera.hpp"
+
+#include "../src/sound/sound_types/sound_types.hpp"
+
+#include "../src/utility/jolt_glm_type_conversions/jolt_glm_type_conversions.hpp"
+#include "../src/utility/logger/logger.hpp"
+#include "../src/utility/meta_utils/meta_utils.hpp"
+
+#include "../src/system_logic/client_session/client_session.hpp"
+#include "../src/system_logic/hermite_interpolation/hermite_interpolation.hpp"
+#include "../src/system_logic/hitscan_logic/hitscan_logic.hpp"
+#include "../src/system_logic/jitter_buffer/jitter_buffer.hpp"
+#include "../src/system_logic/rewind_history/rewind_history.hpp"
+#include "../src/system_logic/sequence_buffer/sequence_buffer.hpp"
+#include "../src/system_logic/server_simulation/server_simulation.hpp"
+
+// NOTE: measures how often the server agrees with what the player saw. A scripted shooter follows the client's logic
+// (prediction and reconciliation of the camera, entity interpolation out of a jitter buffer and subtick firing) and decides whether each shot hit by casting against the target exactly where it was drawn, that is the
+// oracle, the server then rewinds and casts the same shot and its verdict comes back as a sound update. Shots are
+// aimed at the drawn target plus a random error so that plenty of them land near its edge, where disagreements show
+// up. Everything runs over the loopback transport on a virtual clock with the target on a fixed orbit, so only the
+// per shot cost depends on the machine.
+//
+// usage: hit_registration_benchmark [seconds_per_run] [max_aim_error_radians] [frame_rate]
+
+struct ShooterSettings {
+    double frame_rate = 240;
+    // NOTE: how often mouse updates go out and the rate the client assumes game updates come in at
+    double send_rate = 60;
+    double fire_interval = 0.25;
+    // NOTE: each shot is aimed this far off the center of the target at most, in a random direction
+    double max_aim_error = 0.1;
+    // NOTE: in radians per second, keeps the aim moving like a hand would rather than snapping
+    double max_turn_speed = 12;
+    double sensitivity = 1;
+    unsigned int seed = 0;
+};
+
+class ScriptedShooter {
+  public:
+    ScriptedShooter(ClientTransport &transport, const ShooterSettings &settings, const JPH::Shape &target_shape)
+        : transport(transport), settings(settings), target_shape(target_shape), random_engine(settings.seed),
+          game_update_jitter_buffer(make_jitter_buffer_settings(settings)), update_number_to_received_game_update(128) {
+        register_packet_handlers();
+        pick_aim_error();
+    }
+
+    // NOTE: one rendered frame, in the order the client does things, the mouse moved during the previous frame's
+    // event polling which is why it comes first
+    void frame(double time) {
+        frame_time = time;
+        move_mouse();
+
+        if (crossed_period(time, 1 / settings.send_rate)) {
+            send_mouse_update();
+        }
+
+        std::vector<PacketWithSize> pws = transport.get_network_events_received_since_last_tick();
+        packet_handler.handle_packets(pws);
+
+        interpolate_target(time);
+
+        if (target_is_drawn and time >= next_fire_time) {
+            fire();
+            next_fire_time = time + settings.fire_interval;
+        }
+
+        last_frame_time = time;
+    }
+
+    // NOTE: in the order the shots were fired, the server answers every shot with exactly one sound in that order
+    const std::vector<bool> &get_client_verdicts() const { return client_verdicts; }
+    const std::vector<bool> &get_server_verdicts() const { return server_verdicts; }
+
+  private:
+    struct LabelledMousePos {
+        unsigned int mouse_pos_update_number;
+        double x_pos;
+        double y_pos;
+    };
+
+    bool crossed_period(double time, double period) const {
+        return std::floor(time / period) != std::floor(last_frame_time / period) or time == 0;
+    }
+
+    void register_packet_handlers() {
+        packet_handler.register_handler(PacketType::GAME_UPDATE, [this](std::vector<uint8_t> raw_packet) {
+            GameUpdatePacket packet;
+            if (wire_format::deserialize(std::span<const uint8_t>(raw_packet), packet)) {
+                apply_game_update(packet.game_update);
+            }
+        });
+        packet_handler.register_handler(PacketType::GAME_UPDATE_QUANTIZED, [this](std::vector<uint8_t> raw_packet) {
+            GameUpdate game_update;
+            wire_format::ByteReader reader(raw_packet);
+            if (wire_format::deserialize_quantized(reader, game_update, last_received_game_update_number,
+                                                   mouse_pos_update_number)) {
+                apply_game_update(game_update);
+            }
+        });
+        packet_handler.register_handler(PacketType::GAME_UPDATE_DELTA, [this](std::vector<uint8_t> raw_packet) {
+            GameUpdate game_update;
+            wire_format::ByteReader reader(raw_packet);
+            auto get_baseline = [this](unsigned int baseline_update_number) -> const GameUpdate * {
+                return update_number_to_received_game_update.get(baseline_update_number);
+            };
+            if (wire_format::deserialize_delta(reader, game_update, last_received_game_update_number,
+                                               mouse_pos_update_number, get_baseline)) {
+                apply_game_update(game_update);
+            }
+        });
+        packet_handler.register_handler(PacketType::SOUND_UPDATE, [this](std::vector<uint8_t> raw_packet) {
+            SoundUpdatePacket packet;
+            if (not wire_format::deserialize(std::span<const uint8_t>(raw_packet), packet)) {
+                return;
+            }
+            if (packet.sound_update.sound_to_play == SoundType::SERVER_HIT) {
+                server_verdicts.push_back(true);
+            } else if (packet.sound_update.sound_to_play == SoundType::SERVER_MISS) {
+                server_verdicts.push_back(false);
+            }
+        });
+        packet_handler.register_handler(PacketType::GAME_FRAME, [this](std::vector<uint8_t> raw_packet) {
+            std::vector<PacketWithSize> packets_in_frame;
+            if (wire_format::split_game_frame(raw_packet, packets_in_frame)) {
+                packet_handler.handle_packets(packets_in_frame);
+            }
+        });
+    }
+
+    // NOTE: the same as apply_game_update in the client with entity interpolation on
+    void apply_game_update(const GameUpdate &game_update) {
+        if (not update_number_to_received_game_update.is_older_than_rewind_window(game_update.update_number)) {
+            update_number_to_received_game_update.record(game_update.update_number) = game_update;
+        }
+        bool is_stale = has_received_game_update and game_update.update_number <= last_received_game_update_number;
+        game_update_jitter_buffer.insert(game_update.update_number, game_update, frame_time);
+        if (is_stale) {
+            return;
+        }
+        has_received_game_update = true;
+        last_received_game_update_number = game_update.update_number;
+        client_id = game_update.client_id;
+
+        fps_camera.transform.set_rotation_pitch(game_update.pitch);
+        fps_camera.transform.set_rotation_yaw(game_update.yaw);
+        last_applied_game_update_number_camera_cpsr = game_update.update_number;
+
+        unsigned int last_processed = game_update.last_processed_mouse_pos_update_number;
+        mouse_pos_history.discard_before(last_processed);
+        if (const LabelledMousePos *lmp = mouse_pos_history.get(last_processed)) {
+            fps_camera.mouse.last_mouse_position_x = lmp->x_pos;
+            fps_camera.mouse.last_mouse_position_y = lmp->y_pos;
+        }
+        for (unsigned int n = std::max(last_processed + 1, mouse_pos_history.get_first_sequence_number());
+             n < mouse_pos_history.get_end_sequence_number(); n++) {
+            fps_camera.mouse_callback(mouse_pos_history[n].x_pos, mouse_pos_history[n].y_pos, settings.sensitivity);
+        }
+    }
+
+    void interpolate_target(double time) {
+        target_is_drawn = false;
+        auto playout = game_update_jitter_buffer.get_playout(time);
+        if (not playout.available) {
+            return;
+        }
+        const GameUpdate &start = *playout.start_snapshot;
+        const GameUpdate &end = *playout.end_snapshot;
+        glm::vec3 start_position(start.target_x_pos, start.target_y_pos, start.target_z_pos);
+        glm::vec3 end_position(end.target_x_pos, end.target_y_pos, end.target_z_pos);
+        glm::vec3 start_velocity(start.target_x_vel, start.target_y_vel, start.target_z_vel);
+        glm::vec3 end_velocity(end.target_x_vel, end.target_y_vel, end.target_z_vel);
+
+        if (playout.starved) {
+            drawn_target_position = extrapolate_position(start_position, start_velocity, playout.extrapolation);
+        } else {
+            drawn_target_position = hermite_interpolate(start_position, start_velocity, end_position, end_velocity,
+                                                        playout.duration, playout.fraction);
+        }
+        target_is_drawn = true;
+        last_applied_game_update_number_entity_interpolation = playout.update_number;
+        percentage_through_cycle = playout.update_fraction;
+        entity_extrapolation = playout.starved ? playout.extrapolation : 0;
+    }
+
+    static JitterBuffer<GameUpdate>::Settings make_jitter_buffer_settings(const ShooterSettings &settings) {
+        JitterBuffer<GameUpdate>::Settings jitter_buffer_settings;
+        jitter_buffer_settings.tick_rate = settings.send_rate;
+        return jitter_buffer_settings;
+    }
+
+    glm::vec3 camera_forward() { return glm::normalize(fps_camera.transform.compute_forward_vector()); }
+
+    // NOTE: the forward vector after moving the mouse by (dx, dy) from where it is, the camera is put back after
+    glm::vec3 probe_forward(double dx, double dy) {
+        CameraReconstructionData crd = get_camera_reconstruction_data(fps_camera);
+        fps_camera.mouse_callback(mouse_x + dx, mouse_y + dy, settings.sensitivity);
+        glm::vec3 forward = camera_forward();
+        set_camera_state(crd, fps_camera);
+        return forward;
+    }
+
+    void pick_aim_error() {
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+        aim_error = settings.max_aim_error * unit(random_engine);
+        aim_error_direction = 2 * glm::pi<double>() * unit(random_engine);
+    }
+
+    // NOTE: the camera is at the origin, so the direction to the target is its position, we don't know how the camera
+    // maps mouse movement to angles so the mouse step is found from how the forward vector responds to a small probe
+    void move_mouse() {
+        if (target_is_drawn) {
+            glm::vec3 to_target = glm::normalize(drawn_target_position);
+            glm::vec3 side = glm::normalize(glm::cross(to_target, glm::vec3(0, 1, 0)));
+            glm::vec3 up = glm::cross(side, to_target);
+            float offset = std::tan(aim_error);
+            glm::vec3 desired = glm::normalize(to_target + offset * (float(std::cos(aim_error_direction)) * side +
+                                                                     float(std::sin(aim_error_direction)) * up));
+
+            glm::vec3 forward = camera_forward();
+            glm::vec3 jx = probe_forward(1, 0) - forward;
+            glm::vec3 jy = probe_forward(0, 1) - forward;
+            glm::vec3 error = desired - forward;
+
+            // NOTE: least squares for the mouse movement that best turns forward into desired
+            double a = glm::dot(jx, jx), b = glm::dot(jx, jy), c = glm::dot(jy, jy);
+            double determinant = a * c - b * b;
+            if (determinant > 1e-12) {
+                double rx = glm::dot(jx, error), ry = glm::dot(jy, error);
+                double dx = (c * rx - b * ry) / determinant;
+                double dy = (a * ry - b * rx) / determinant;
+
+                double turn = glm::length(float(dx) * jx + float(dy) * jy);
+                double max_turn = settings.max_turn_speed / settings.frame_rate;
+                if (turn > max_turn) {
+                    dx *= max_turn / turn;
+                    dy *= max_turn / turn;
+                }
+                mouse_x += dx;
+                mouse_y += dy;
+            }
+        }
+
+        fps_camera.mouse_callback(mouse_x, mouse_y, settings.sensitivity);
+        mouse_pos_history.push_back({mouse_pos_update_number, mouse_x, mouse_y});
+        mouse_pos_update_number++;
+    }
+
+    void send_mouse_update() {
+        if (not mouse_pos_history.empty() and has_received_game_update) {
+            const LabelledMousePos &last_mouse_pos = mouse_pos_history.back();
+            MouseUpdate mu(client_id, last_mouse_pos.mouse_pos_update_number, has_received_game_update,
+                           last_received_game_update_number,
+                           last_applied_game_update_number_before_firing_entity_interpolation,
+                           last_applied_game_update_number_before_firing_camera_cpsr,
+                           subtick_percent_that_fire_occurred_at, entity_extrapolation_when_fire_occurred,
+                           subtick_x_pos_before_firing, subtick_y_pos_before_firing, last_mouse_pos.x_pos,
+                           last_mouse_pos.y_pos, fire_pressed_since_last_send, settings.sensitivity);
+
+            std::array<uint8_t, wire_format::max_size_when_quantized_mouse_update> buffer;
+            wire_format::ByteWriter writer(buffer);
+            wire_format::serialize_quantized(mu, writer);
+            transport.send_packet(buffer.data(), writer.get_bytes_written());
+        }
+        fire_pressed_since_last_send = false;
+    }
+
+    void fire() {
+        if (fire_pressed_since_last_send) {
+            // NOTE: the client only fires once per mouse update, see fire_just_occurred
+            return;
+        }
+        fire_pressed_since_last_send = true;
+        last_applied_game_update_number_before_firing_entity_interpolation =
+            last_applied_game_update_number_entity_interpolation;
+        last_applied_game_update_number_before_firing_camera_cpsr = last_applied_game_update_number_camera_cpsr;
+        subtick_percent_that_fire_occurred_at = percentage_through_cycle;
+        entity_extrapolation_when_fire_occurred = entity_extrapolation;
+        subtick_x_pos_before_firing = fps_camera.mouse.last_mouse_position_x;
+        subtick_y_pos_before_firing = fps_camera.mouse.last_mouse_position_y;
+
+        client_verdicts.push_back(run_hitscan_logic(make_aim_ray(fps_camera), g2j(drawn_target_position),
+                                                    JPH::Quat::sIdentity(), target_shape));
+        pick_aim_error();
+    }
+
+    ClientTransport &transport;
+    ShooterSettings settings;
+    const JPH::Shape &target_shape;
+    std::mt19937 random_engine;
+    PacketHandler packet_handler;
+    FPSCamera fps_camera;
+
+    double frame_time = 0;
+    double last_frame_time = 0;
+    double mouse_x = 0;
+    double mouse_y = 0;
+    unsigned int mouse_pos_update_number = 0;
+    SequenceBuffer<LabelledMousePos> mouse_pos_history{1024};
+
+    double aim_error = 0;
+    double aim_error_direction = 0;
+    double next_fire_time = 0;
+
+    JitterBuffer<GameUpdate> game_update_jitter_buffer;
+    bool target_is_drawn = false;
+    glm::vec3 drawn_target_position{0};
+    double percentage_through_cycle = 0;
+    // NOTE: seconds past the entity interpolation game update the target was dead reckoned when starved
+    double entity_extrapolation = 0;
+
+    unsigned int last_applied_game_update_number_entity_interpolation = 0;
+    unsigned int last_applied_game_update_number_camera_cpsr = 0;
+    unsigned int last_applied_game_update_number_before_firing_entity_interpolation = 0;
+    unsigned int last_applied_game_update_number_before_firing_camera_cpsr = 0;
+    bool fire_pressed_since_last_send = false;
+    double subtick_percent_that_fire_occurred_at = 0;
+    double entity_extrapolation_when_fire_occurred = 0;
+    double subtick_x_pos_before_firing = 0;
+    double subtick_y_pos_before_firing = 0;
+
+    unsigned int client_id = 0;
+    bool has_received_game_update = false;
+    unsigned int last_received_game_update_number = 0;
+    RewindHistory<GameUpdate> update_number_to_received_game_update;
+
+    std::vector<bool> client_verdicts;
+    std::vector<bool> server_verdicts;
+};
+
+struct AgreementResult {
+    uint64_t shots = 0;
+    uint64_t client_hits = 0;
+    uint64_t agreements = 0;
+    // NOTE: the server said hit when the player saw a miss
+    uint64_t false_positives = 0;
+    // NOTE: the server said miss when the player saw a hit
+    uint64_t false_negatives = 0;
+    uint64_t rejected_shots = 0;
+    double nanoseconds_per_shot = 0;
+};
+
+AgreementResult run_benchmark(double tick_rate, double one_way_latency, double seconds, const ShooterSettings &base,
+                              meta_program::MetaProgram &mp) {
+    LoopbackHub hub(one_way_latency);
+
+    ServerSimulationSettings simulation_settings;
+    simulation_settings.worker_threads = 1;
+    simulation_settings.move_target_on_hit = false;
+    ServerSimulation simulation(simulation_settings, hub.get_server_transport(), mp);
+
+    ShooterSettings shooter_settings = base;
+    // NOTE: the client sends and interpolates at the rate the server ticks at, as it would if that were shared
+    shooter_settings.send_rate = tick_rate;
+    ScriptedShooter shooter(hub.connect_client(), shooter_settings, simulation.get_target_shape());
+
+    double tick_dt = 1 / tick_rate;
+    double frame_dt = 1 / shooter_settings.frame_rate;
+    double next_tick_time = 0;
+    unsigned int frame_count = static_cast<unsigned int>(seconds * shooter_settings.frame_rate);
+    for (unsigned int frame = 0; frame < frame_count; frame++) {
+        double time = frame * frame_dt;
+        while (next_tick_time <= time) {
+            simulation.tick(tick_dt);
+            next_tick_time += tick_dt;
+        }
+        shooter.frame(time);
+        hub.advance_time(frame_dt);
+    }
+
+    // NOTE: shots fired at the very end may not have been answered yet, they are left out
+    const std::vector<bool> &client_verdicts = shooter.get_client_verdicts();
+    const std::vector<bool> &server_verdicts = shooter.get_server_verdicts();
+    AgreementResult result;
+    result.shots = std::min(client_verdicts.size(), server_verdicts.size());
+    for (size_t i = 0; i < result.shots; i++) {
+        result.client_hits += client_verdicts[i];
+        result.agreements += client_verdicts[i] == server_verdicts[i];
+        result.false_positives += server_verdicts[i] and not client_verdicts[i];
+        result.false_negatives += client_verdicts[i] and not server_verdicts[i];
+    }
+
+    const ServerSimulationStatistics &statistics = simulation.get_statistics();
+    result.rejected_shots = statistics.rejected_shots;
+    uint64_t reconstructed_shots = statistics.shots - statistics.rejected_shots;
+    if (reconstructed_shots > 0) {
+        result.nanoseconds_per_shot = 1e9 * statistics.shot_reconstruction_seconds / reconstructed_shots;
+    }
+    return result;
+}
+
+int main(int argc, char *argv[]) {
+
+    global_logger.remove_all_sinks();
+
+    double seconds_per_run = argc > 1 ? std::stod(argv[1]) : 120;
+    ShooterSettings shooter_settings;
+    shooter_settings.max_aim_error = argc > 2 ? std::stod(argv[2]) : shooter_settings.max_aim_error;
+    shooter_settings.frame_rate = argc > 3 ? std::stod(argv[3]) : shooter_settings.frame_rate;
+
+    meta_program::MetaProgram mp(meta_utils::meta_types.get_concrete_types());
+
+    std::cout << fmt::format("{} simulated seconds per run, {} fps client, aim error up to {} rad, a shot every {} s",
+                             seconds_per_run, shooter_settings.frame_rate, shooter_settings.max_aim_error,
+                             shooter_settings.fire_interval)
+              << std::endl;
+    std::cout << fmt::format("{:>8} {:>10} | {:>6} {:>8} | {:>10} {:>6} {:>6} {:>9} | {:>9}", "tick Hz", "one way ms",
+                             "shots", "seen hit", "agreement", "FP", "FN", "rejected", "ns/shot")
+              << std::endl;
+
+    for (double tick_rate : {30.0, 60.0, 128.0}) {
+        for (double one_way_latency_ms : {0.0, 25.0, 50.0, 100.0}) {
+            AgreementResult result =
+                run_benchmark(tick_rate, one_way_latency_ms / 1000, seconds_per_run, shooter_settings, mp);
+            double agreement = result.shots > 0 ? 100.0 * result.agreements / result.shots : 0.0;
+            std::cout << fmt::format("{:>8.0f} {:>10.0f} | {:>6} {:>8} | {:>9.2f}% {:>6} {:>6} {:>9} | {:>9.0f}",
+                                     tick_rate, one_way_latency_ms, result.shots, result.client_hits, agreement,
+                                     result.false_positives, result.false_negatives, result.rejected_shots,
+                                     result.nanoseconds_per_shot)
+                      << std::endl;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,188 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Physics/Character/CharacterVirtual.h>
+#include <Jolt/Physics/Collision/RayCast.h>
+
+#include <fmt/core.h>
+
+#include <glm/glm.hpp>
+
+#include "../src/utility/logger/logger.hpp"
+
+#include "../src/system_logic/entity_snapshot/entity_snapshot.hpp"
+#include "../src/system_logic/hitscan_history/hitscan_history.hpp"
+#include "../src/system_logic/orbiter_set/orbiter_set.hpp"
+#include "../src/system_logic/physics/physics.hpp"
+#include "../src/system_logic/sphere_orbiter/sphere_orbiter.hpp"
+
+// NOTE: measures what a rewound shot costs when there are many targets. The targets are set up like in the
+// hitscan_world benchmark and every tick all of them are recorded into a HitscanHistory, then a batch of shots is cast
+// at random points (ticks and the time in between them) inside the rewind window, once through the swept bvhs and once
+// by interpolating and casting against every target, which also checks that both hit at the same spot. Recording only
+// starts being timed once the history is full, by then it isn't growing anymore.
+//
+// usage: hitscan_history_benchmark [ticks] [shots_per_tick] [max_rewind_ticks]
+
+struct BenchmarkSettings {
+    unsigned int ticks;
+    unsigned int shots_per_tick;
+    unsigned int max_rewind_ticks;
+    float tick_rate = 60;
+    // NOTE: the average distance between neighbouring targets
+    float spacing = 4;
+};
+
+struct HistoryResult {
+    double record_seconds = 0;
+    unsigned int recorded_ticks = 0;
+    double bvh_seconds = 0;
+    double every_target_seconds = 0;
+    uint64_t shots = 0;
+    uint64_t hits = 0;
+    uint64_t mismatches = 0;
+};
+
+struct Shot {
+    JPH::RayCast aim_ray;
+    double update_number;
+};
+
+struct ShotResult {
+    bool hit = false;
+    size_t target = 0;
+    float fraction = 0;
+};
+
+HistoryResult run_benchmark(const BenchmarkSettings &settings, size_t target_count,
+                            const EntityShapeRegistry &shape_registry, uint32_t target_shape_id) {
+    HistoryResult result;
+    float arena_size = settings.spacing * std::sqrt(float(target_count));
+    float dt = 1 / settings.tick_rate;
+    std::mt19937 random_engine(0);
+    std::uniform_real_distribution<float> unit(0, 1);
+
+    OrbiterSet orbiter_set;
+    for (size_t i = 0; i < target_count; i++) {
+        glm::vec3 center(arena_size * (unit(random_engine) - 0.5f), 1 + 2 * unit(random_engine),
+                         arena_size * (unit(random_engine) - 0.5f));
+        glm::vec3 travel_axis(unit(random_engine) - 0.5f, unit(random_engine) - 0.5f, unit(random_engine) - 0.5f);
+        orbiter_set.add(SphereOrbiter(center, 0.5f + unit(random_engine), glm::normalize(travel_axis),
+                                      glm::radians(45.0f + 135.0f * unit(random_engine)), 6.28f * unit(random_engine)));
+    }
+
+    HitscanHistory hitscan_history(settings.max_rewind_ticks, shape_registry);
+    std::vector<EntitySnapshot> targets(target_count);
+    // NOTE: the history is filled up before the first shot so that every tick starts out with a full window
+    unsigned int total_ticks = settings.max_rewind_ticks + settings.ticks;
+    for (unsigned int update_number = 0; update_number < total_ticks; update_number++) {
+        orbiter_set.process(dt);
+        for (size_t i = 0; i < target_count; i++) {
+            glm::vec3 position = orbiter_set.get_position(i);
+            glm::vec3 velocity = orbiter_set.get_velocity(i);
+            targets[i] = {{position.x, position.y, position.z},
+                          {velocity.x, velocity.y, velocity.z},
+                          {0, 0, 0, 1},
+                          target_shape_id};
+        }
+
+        auto record_start = std::chrono::steady_clock::now();
+        hitscan_history.record(update_number, targets, dt);
+        double record_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - record_start).count();
+        if (update_number < settings.max_rewind_ticks) {
+            continue;
+        }
+        result.record_seconds += record_seconds;
+        result.recorded_ticks++;
+
+        std::vector<Shot> shots;
+        for (unsigned int i = 0; i < settings.shots_per_tick; i++) {
+            Shot shot;
+            shot.aim_ray.mOrigin = JPH::Vec3(arena_size * (unit(random_engine) - 0.5f), 1.7f,
+                                             arena_size * (unit(random_engine) - 0.5f));
+            float yaw = 6.28f * unit(random_engine);
+            float pitch = 0.2f * (unit(random_engine) - 0.5f);
+            shot.aim_ray.mDirection =
+                JPH::Vec3(std::cos(yaw) * std::cos(pitch), std::sin(pitch), std::sin(yaw) * std::cos(pitch)) * 100;
+            shot.update_number = update_number - settings.max_rewind_ticks * double(unit(random_engine));
+            shots.push_back(shot);
+        }
+
+        std::vector<ShotResult> bvh_results(shots.size());
+        auto bvh_start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < shots.size(); i++) {
+            EntitySnapshot hit_snapshot;
+            bvh_results[i].hit = hitscan_history.cast_ray(shots[i].aim_ray, shots[i].update_number,
+                                                          bvh_results[i].target, bvh_results[i].fraction, hit_snapshot);
+        }
+        result.bvh_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - bvh_start).count();
+
+        std::vector<ShotResult> every_target_results(shots.size());
+        auto every_target_start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < shots.size(); i++) {
+            EntitySnapshot hit_snapshot;
+            every_target_results[i].hit = hitscan_history.cast_ray_against_every_target(
+                shots[i].aim_ray, shots[i].update_number, every_target_results[i].target,
+                every_target_results[i].fraction, hit_snapshot);
+        }
+        result.every_target_seconds +=
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - every_target_start).count();
+
+        for (size_t i = 0; i < shots.size(); i++) {
+            const ShotResult &bvh_result = bvh_results[i];
+            const ShotResult &every_target_result = every_target_results[i];
+            result.shots++;
+            result.hits += bvh_result.hit;
+            // NOTE: a different target at the same fraction is a tie (the shot starting inside both of them) which
+            // either one is right about
+            result.mismatches += bvh_result.hit != every_target_result.hit or
+                                 (bvh_result.hit and bvh_result.fraction != every_target_result.fraction);
+        }
+    }
+    return result;
+}
+
+int main(int argc, char *argv[]) {
+
+    global_logger.remove_all_sinks();
+
+    BenchmarkSettings settings;
+    settings.ticks = argc > 1 ? std::stoul(argv[1]) : 20;
+    settings.shots_per_tick = argc > 2 ? std::stoul(argv[2]) : 64;
+    settings.max_rewind_ticks = argc > 3 ? std::stoul(argv[3]) : 60;
+
+    // NOTE: only here for the target's shape, so that the targets are the same as the one the server has
+    Physics physics;
+    JPH::Ref<JPH::CharacterVirtual> physics_target = physics.create_character(0);
+    EntityShapeRegistry shape_registry;
+    uint32_t target_shape_id = shape_registry.register_shape(physics_target->GetShape());
+
+    std::cout << fmt::format("{} ticks, {} shots per tick, {} tick rewind window at {} Hz, targets {} m apart",
+                             settings.ticks, settings.shots_per_tick, settings.max_rewind_ticks, settings.tick_rate,
+                             settings.spacing)
+              << std::endl;
+    std::cout << fmt::format("{:>8} | {:>10} | {:>10} {:>12} {:>8} | {:>6} {:>10}", "targets", "record us",
+                             "bvh ns", "every ns", "speedup", "hits", "mismatches")
+              << std::endl;
+
+    // NOTE: the history holds max_rewind_ticks + 1 copies of every target and its box, so this stops short of the
+    // 100k the hitscan_world benchmark goes up to
+    for (size_t target_count : {10, 100, 1000, 10000}) {
+        HistoryResult result = run_benchmark(settings, target_count, shape_registry, target_shape_id);
+        double shots = std::max<uint64_t>(result.shots, 1);
+        std::cout << fmt::format("{:>8} | {:>10.1f} | {:>10.0f} {:>12.0f} {:>7.1f}x | {:>5.1f}% {:>10}", target_count,
+                                 1e6 * result.record_seconds / std::max(result.recorded_ticks, 1u),
+                                 1e9 * result.bvh_seconds / shots, 1e9 * result.every_target_seconds / shots,
+                                 result.every_target_seconds / result.bvh_seconds, 100 * result.hits / shots,
+                                 result.mismatches)
+                  << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,145 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Physics/Character/CharacterVirtual.h>
+#include <Jolt/Physics/Collision/RayCast.h>
+
+#include <fmt/core.h>
+
+#include <glm/glm.hpp>
+
+#include "../src/utility/jolt_glm_type_conversions/jolt_glm_type_conversions.hpp"
+#include "../src/utility/logger/logger.hpp"
+
+#include "../src/system_logic/hitscan_world/hitscan_world.hpp"
+#include "../src/system_logic/orbiter_set/orbiter_set.hpp"
+#include "../src/system_logic/physics/physics.hpp"
+#include "../src/system_logic/sphere_orbiter/sphere_orbiter.hpp"
+
+// NOTE: measures what a shot costs in a world with many targets. The targets all have the server's target shape and
+// orbit around an arena that grows with their number so that they're always about as far apart, every tick they're
+// moved, the world is rebuilt and a batch of shots (100 m rays from random points in the arena) is cast with the bvh
+// and by casting against every target, which also checks that both find the same target.
+//
+// usage: hitscan_world_benchmark [ticks] [shots_per_tick]
+
+struct BenchmarkSettings {
+    unsigned int ticks;
+    unsigned int shots_per_tick;
+    // NOTE: the average distance between neighbouring targets
+    float spacing = 4;
+};
+
+struct WorldResult {
+    double build_seconds = 0;
+    double bvh_seconds = 0;
+    double every_target_seconds = 0;
+    uint64_t shots = 0;
+    uint64_t hits = 0;
+    uint64_t mismatches = 0;
+};
+
+WorldResult run_benchmark(const BenchmarkSettings &settings, size_t target_count, const JPH::Shape &target_shape) {
+    WorldResult result;
+    float arena_size = settings.spacing * std::sqrt(float(target_count));
+    std::mt19937 random_engine(0);
+    std::uniform_real_distribution<float> unit(0, 1);
+
+    OrbiterSet orbiter_set;
+    for (size_t i = 0; i < target_count; i++) {
+        glm::vec3 center(arena_size * (unit(random_engine) - 0.5f), 1 + 2 * unit(random_engine),
+                         arena_size * (unit(random_engine) - 0.5f));
+        glm::vec3 travel_axis(unit(random_engine) - 0.5f, unit(random_engine) - 0.5f, unit(random_engine) - 0.5f);
+        orbiter_set.add(SphereOrbiter(center, 0.5f + unit(random_engine), glm::normalize(travel_axis),
+                                      glm::radians(45.0f + 135.0f * unit(random_engine)), 6.28f * unit(random_engine)));
+    }
+
+    HitscanWorld hitscan_world;
+    std::vector<HitscanTarget> targets(target_count);
+    for (unsigned int tick = 0; tick < settings.ticks; tick++) {
+        orbiter_set.process(1 / 60.0f);
+        for (size_t i = 0; i < target_count; i++) {
+            targets[i] = {g2j(orbiter_set.get_position(i)), JPH::Quat::sIdentity(), &target_shape};
+        }
+
+        auto build_start = std::chrono::steady_clock::now();
+        hitscan_world.set_targets(targets);
+        result.build_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - build_start).count();
+
+        std::vector<JPH::RayCast> aim_rays;
+        for (unsigned int shot = 0; shot < settings.shots_per_tick; shot++) {
+            JPH::RayCast aim_ray;
+            aim_ray.mOrigin = JPH::Vec3(arena_size * (unit(random_engine) - 0.5f), 1.7f,
+                                        arena_size * (unit(random_engine) - 0.5f));
+            float yaw = 6.28f * unit(random_engine);
+            float pitch = 0.2f * (unit(random_engine) - 0.5f);
+            aim_ray.mDirection =
+                JPH::Vec3(std::cos(yaw) * std::cos(pitch), std::sin(pitch), std::sin(yaw) * std::cos(pitch)) * 100;
+            aim_rays.push_back(aim_ray);
+        }
+
+        std::vector<size_t> bvh_hit_targets(aim_rays.size(), target_count);
+        auto bvh_start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < aim_rays.size(); i++) {
+            float hit_fraction;
+            hitscan_world.cast_ray(aim_rays[i], bvh_hit_targets[i], hit_fraction);
+        }
+        result.bvh_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - bvh_start).count();
+
+        std::vector<size_t> every_target_hit_targets(aim_rays.size(), target_count);
+        auto every_target_start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < aim_rays.size(); i++) {
+            float hit_fraction;
+            hitscan_world.cast_ray_against_every_target(aim_rays[i], every_target_hit_targets[i], hit_fraction);
+        }
+        result.every_target_seconds +=
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - every_target_start).count();
+
+        for (size_t i = 0; i < aim_rays.size(); i++) {
+            result.shots++;
+            result.hits += bvh_hit_targets[i] != target_count;
+            result.mismatches += bvh_hit_targets[i] != every_target_hit_targets[i];
+        }
+    }
+    return result;
+}
+
+int main(int argc, char *argv[]) {
+
+    global_logger.remove_all_sinks();
+
+    BenchmarkSettings settings;
+    settings.ticks = argc > 1 ? std::stoul(argv[1]) : 20;
+    settings.shots_per_tick = argc > 2 ? std::stoul(argv[2]) : 64;
+
+    // NOTE: only here for the target's shape, so that the targets are the same as the one the server has
+    Physics physics;
+    JPH::Ref<JPH::CharacterVirtual> physics_target = physics.create_character(0);
+    const JPH::Shape &target_shape = *physics_target->GetShape();
+
+    std::cout << fmt::format("{} ticks, {} shots per tick, targets {} m apart", settings.ticks,
+                             settings.shots_per_tick, settings.spacing)
+              << std::endl;
+    std::cout << fmt::format("{:>8} | {:>10} | {:>10} {:>12} {:>8} | {:>6} {:>10}", "targets", "build us",
+                             "bvh ns", "every ns", "speedup", "hits", "mismatches")
+              << std::endl;
+
+    for (size_t target_count : {10, 100, 1000, 10000, 100000}) {
+        WorldResult result = run_benchmark(settings, target_count, target_shape);
+        double shots = std::max<uint64_t>(result.shots, 1);
+        std::cout << fmt::format("{:>8} | {:>10.1f} | {:>10.0f} {:>12.0f} {:>7.1f}x | {:>5.1f}% {:>10}", target_count,
+                                 1e6 * result.build_seconds / settings.ticks, 1e9 * result.bvh_seconds / shots,
+                                 1e9 * result.every_target_seconds / shots,
+                                 result.every_target_seconds / result.bvh_seconds, 100 * result.hits / shots,
+                                 result.mismatches)
+                  << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,187 @@
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include <glm/glm.hpp>
+
+#include "../src/networking/wire_format/wire_format.hpp"
+
+#include "../src/utility/logger/logger.hpp"
+
+#include "../src/system_logic/hermite_interpolation/hermite_interpolation.hpp"
+#include "../src/system_logic/sphere_orbiter/sphere_orbiter.hpp"
+
+// NOTE: measures how far the target the client draws is from where the server actually had it, at a range of send
+// rates. The target follows its orbit, one snapshot per tick is taken with the position and velocity quantized as they
+// are on the wire, and every frame the client draws the point a tick behind the newest snapshot, once interpolating
+// linearly and once with the hermite interpolation it uses now. Extrapolation is measured by pretending the snapshots
+// stopped coming for a while, dead reckoning along the velocity is compared against holding the newest snapshot. The
+// error is reported in millimeters and as the angle it covers seen from the origin, where the player stands. Time is
+// virtual.
+//
+// usage: interpolation_benchmark [seconds] [frame_rate] [angular_speed_degrees]
+
+struct Snapshot {
+    glm::vec3 position;
+    glm::vec3 velocity;
+};
+
+struct ErrorResult {
+    double mean_distance = 0;
+    double max_distance = 0;
+    double mean_angle = 0;
+    double max_angle = 0;
+    uint64_t samples = 0;
+
+    void add(const glm::vec3 &drawn, const glm::vec3 &actual) {
+        double distance = glm::length(drawn - actual);
+        double angle = std::atan2(glm::length(glm::cross(drawn, actual)), glm::dot(drawn, actual));
+        mean_distance += distance;
+        mean_angle += angle;
+        max_distance = std::max(max_distance, distance);
+        max_angle = std::max(max_angle, angle);
+        samples++;
+    }
+
+    void finish() {
+        mean_distance /= std::max<uint64_t>(samples, 1);
+        mean_angle /= std::max<uint64_t>(samples, 1);
+    }
+};
+
+struct InterpolationResult {
+    ErrorResult linear;
+    ErrorResult hermite;
+};
+
+// NOTE: what the client gets after the snapshot went through the quantized encoding
+Snapshot take_snapshot(const SphereOrbiter &sphere_orbiter, const glm::vec3 &position) {
+    auto through_the_wire = [](const glm::vec3 &value, const wire_format::QuantizedRange &range) {
+        return glm::vec3(wire_format::dequantize(wire_format::quantize(value.x, range), range),
+                         wire_format::dequantize(wire_format::quantize(value.y, range), range),
+                         wire_format::dequantize(wire_format::quantize(value.z, range), range));
+    };
+    return {through_the_wire(position, wire_format::quantization::target_position),
+            through_the_wire(sphere_orbiter.get_velocity(), wire_format::quantization::target_velocity)};
+}
+
+// NOTE: the orbit is tilted so that every axis moves, it's centered just above the player like in the game
+SphereOrbiter make_orbiter(double angular_speed) {
+    return SphereOrbiter(glm::vec3(0.0f, 1, 0), 6, glm::normalize(glm::vec3(1, 2, 0.5)), angular_speed, 0.0f);
+}
+
+// NOTE: a tick's worth of dt at a time, the same steps the server takes, the orbiter as it was at each snapshot is
+// kept so the ground truth in between can be stepped to from there
+void run_orbit(double angular_speed, double tick_rate, unsigned int tick_count, std::vector<Snapshot> &snapshots,
+               std::vector<SphereOrbiter> &orbiters) {
+    SphereOrbiter sphere_orbiter = make_orbiter(angular_speed);
+    for (unsigned int tick = 0; tick < tick_count; tick++) {
+        glm::vec3 position = sphere_orbiter.process(static_cast<float>(1 / tick_rate));
+        snapshots.push_back(take_snapshot(sphere_orbiter, position));
+        orbiters.push_back(sphere_orbiter);
+    }
+}
+
+glm::vec3 actual_position(SphereOrbiter sphere_orbiter, double elapsed) {
+    return sphere_orbiter.process(static_cast<float>(elapsed));
+}
+
+InterpolationResult run_interpolation(double seconds, double frame_rate, double tick_rate, double angular_speed) {
+    InterpolationResult result;
+    std::vector<Snapshot> snapshots;
+    std::vector<SphereOrbiter> orbiters;
+    run_orbit(angular_speed, tick_rate, static_cast<unsigned int>(seconds * tick_rate), snapshots, orbiters);
+
+    float tick_dt = static_cast<float>(1 / tick_rate);
+    unsigned int frame_count = static_cast<unsigned int>(seconds * frame_rate);
+    for (unsigned int frame = 0; frame < frame_count; frame++) {
+        // NOTE: in ticks on the server's timeline, a tick behind so the next snapshot is always there
+        double ticks = frame * tick_rate / frame_rate;
+        unsigned int start = static_cast<unsigned int>(ticks);
+        if (start + 1 >= snapshots.size()) {
+            break;
+        }
+        float t = static_cast<float>(ticks - start);
+        const Snapshot &start_snapshot = snapshots[start];
+        const Snapshot &end_snapshot = snapshots[start + 1];
+        glm::vec3 actual = actual_position(orbiters[start], t * tick_dt);
+
+        result.linear.add((1 - t) * start_snapshot.position + t * end_snapshot.position, actual);
+        result.hermite.add(hermite_interpolate(start_snapshot.position, start_snapshot.velocity,
+                                               end_snapshot.position, end_snapshot.velocity, tick_dt, t),
+                           actual);
+    }
+
+    result.linear.finish();
+    result.hermite.finish();
+    return result;
+}
+
+struct ExtrapolationResult {
+    ErrorResult held;
+    ErrorResult extrapolated;
+};
+
+// NOTE: starting from every snapshot in turn, how far off we are after going elapsed seconds without another one
+ExtrapolationResult run_extrapolation(double seconds, double tick_rate, double angular_speed, double elapsed) {
+    ExtrapolationResult result;
+    std::vector<Snapshot> snapshots;
+    std::vector<SphereOrbiter> orbiters;
+    run_orbit(angular_speed, tick_rate, static_cast<unsigned int>(seconds * tick_rate), snapshots, orbiters);
+
+    for (unsigned int tick = 0; tick < snapshots.size(); tick++) {
+        glm::vec3 actual = actual_position(orbiters[tick], elapsed);
+        result.held.add(snapshots[tick].position, actual);
+        result.extrapolated.add(
+            extrapolate_position(snapshots[tick].position, snapshots[tick].velocity, static_cast<float>(elapsed)),
+            actual);
+    }
+
+    result.held.finish();
+    result.extrapolated.finish();
+    return result;
+}
+
+void print_error(const std::string &label, double tick_rate, const std::string &method, const ErrorResult &error) {
+    std::cout << fmt::format("{:>14} {:>8.0f} {:>12} | {:>9.2f} {:>9.2f} | {:>10.3f} {:>10.3f}", label, tick_rate,
+                             method, 1e3 * error.mean_distance, 1e3 * error.max_distance, 1e3 * error.mean_angle,
+                             1e3 * error.max_angle)
+              << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+
+    global_logger.remove_all_sinks();
+
+    double seconds = argc > 1 ? std::stod(argv[1]) : 20;
+    double frame_rate = argc > 2 ? std::stod(argv[2]) : 240;
+    double angular_speed = glm::radians(argc > 3 ? std::stod(argv[3]) : 180.0);
+
+    size_t game_update_size = wire_format::max_size_when_quantized_game_update;
+    std::cout << fmt::format("{} s at {} fps, orbit of radius 6 m at {} deg/s, {} byte quantized game updates",
+                             seconds, frame_rate, glm::degrees(angular_speed), game_update_size)
+              << std::endl;
+    std::cout << fmt::format("{:>14} {:>8} {:>12} | {:>9} {:>9} | {:>10} {:>10}", "", "tick Hz", "method", "mean mm",
+                             "max mm", "mean mrad", "max mrad")
+              << std::endl;
+
+    for (double tick_rate : {10.0, 20.0, 30.0, 60.0, 128.0}) {
+        InterpolationResult result = run_interpolation(seconds, frame_rate, tick_rate, angular_speed);
+        std::string label = fmt::format("interp {}B/s", static_cast<size_t>(tick_rate * game_update_size));
+        print_error(label, tick_rate, "linear", result.linear);
+        print_error(label, tick_rate, "hermite", result.hermite);
+    }
+
+    for (double elapsed : {0.05, 0.1}) {
+        ExtrapolationResult result = run_extrapolation(seconds, 60, angular_speed, elapsed);
+        std::string label = fmt::format("starve {} ms", static_cast<int>(elapsed * 1000));
+        print_error(label, 60, "held", result.held);
+        print_error(label, 60, "extrapolated", result.extrapolated);
+    }
+
+    return 0;
+}
@@ -0,0 +1,240 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include "../src/networking/network_sim/network_sim.hpp"
+
+#include "../src/utility/logger/logger.hpp"
+
+#include "../src/system_logic/jitter_buffer/jitter_buffer.hpp"
+
+// NOTE: measures how entity interpolation copes with an impaired connection. The server sends one snapshot per tick
+// over an ImpairedLink and the client draws every frame, the way the client used to do it (interpolate between the two
+// oldest snapshots it has and drop the oldest on a local timer that runs at the tick rate with an arbitrary phase) is
+// compared against the JitterBuffer it uses now. For each frame we look at how old the drawn point on the server's
+// timeline is, whether there was nothing to interpolate towards and whether the drawn point went backwards. Time is
+// virtual.
+//
+// usage: jitter_buffer_benchmark [seconds] [frame_rate] [tick_rate]
+
+struct Snapshot {
+    unsigned int update_number;
+};
+
+struct BenchmarkSettings {
+    double seconds;
+    double frame_rate;
+    double tick_rate;
+};
+
+struct Scenario {
+    std::string name;
+    LinkImpairment impairment;
+    // NOTE: used for the middle third of the run instead when set, so we can see the delay come back down after
+    bool has_burst = false;
+    LinkImpairment burst_impairment;
+};
+
+struct PlayoutResult {
+    std::vector<double> ages;
+    uint64_t frames = 0;
+    uint64_t starved_frames = 0;
+    uint64_t backwards_frames = 0;
+    // NOTE: mean age over the last third of the run
+    double settled_age = 0;
+};
+
+// NOTE: the client's interpolation before JitterBuffer, kept as the baseline
+class TwoOldestPlayout {
+  public:
+    TwoOldestPlayout(double tick_rate, double phase) : tick_period(1 / tick_rate), phase(phase) {}
+
+    void insert(unsigned int update_number, double) { recent_snapshots.push_back({update_number}); }
+
+    // NOTE: the drawn position in ticks, negative when nothing is drawn
+    double get_position(double time, bool &starved) {
+        starved = recent_snapshots.size() < 2;
+        if (starved) {
+            return recent_snapshots.empty() ? -1.0 : recent_snapshots.front().update_number;
+        }
+        double cycles = (time + phase) / tick_period;
+        double t = cycles - std::floor(cycles);
+        double position = (1 - t) * recent_snapshots[0].update_number + t * recent_snapshots[1].update_number;
+        if (std::floor(cycles) != std::floor(last_cycles)) {
+            recent_snapshots.erase(recent_snapshots.begin());
+        }
+        last_cycles = cycles;
+        return position;
+    }
+
+  private:
+    double tick_period;
+    double phase;
+    double last_cycles = 0;
+    std::vector<Snapshot> recent_snapshots;
+};
+
+class JitterBufferPlayout {
+  public:
+    explicit JitterBufferPlayout(double tick_rate) : tick_rate(tick_rate), jitter_buffer(make_settings(tick_rate)) {}
+
+    void insert(unsigned int update_number, double time) {
+        jitter_buffer.insert(update_number, {update_number}, time);
+    }
+
+    double get_position(double time, bool &starved) {
+        auto playout = jitter_buffer.get_playout(time);
+        starved = not playout.available or playout.starved;
+        if (not playout.available) {
+            return -1;
+        }
+        // NOTE: when starved the drawn position is extrapolated past the update number
+        return playout.update_number + double(playout.update_fraction) + playout.extrapolation * tick_rate;
+    }
+
+  private:
+    static JitterBuffer<Snapshot>::Settings make_settings(double tick_rate) {
+        JitterBuffer<Snapshot>::Settings settings;
+        settings.tick_rate = tick_rate;
+        return settings;
+    }
+
+    double tick_rate;
+    JitterBuffer<Snapshot> jitter_buffer;
+};
+
+template <typename Playout>
+PlayoutResult run_benchmark(const BenchmarkSettings &settings, const Scenario &scenario, Playout playout) {
+    PlayoutResult result;
+    ImpairedLink link(scenario.impairment, 0);
+    ImpairedLink burst_link(scenario.burst_impairment, 0);
+
+    double tick_dt = 1 / settings.tick_rate;
+    double frame_dt = 1 / settings.frame_rate;
+    double next_tick_time = 0;
+    unsigned int update_number = 0;
+    unsigned int frame_count = static_cast<unsigned int>(settings.seconds * settings.frame_rate);
+    double last_position = -1;
+    double settled_age_sum = 0;
+    uint64_t settled_frames = 0;
+
+    for (unsigned int frame = 0; frame < frame_count; frame++) {
+        double time = frame * frame_dt;
+        bool in_burst = scenario.has_burst and time >= settings.seconds / 3 and time < 2 * settings.seconds / 3;
+        while (next_tick_time <= time) {
+            ImpairedLink &sending_link = in_burst ? burst_link : link;
+            sending_link.push(std::nullopt, &update_number, sizeof(update_number), next_tick_time);
+            update_number++;
+            next_tick_time += tick_dt;
+        }
+
+        for (ImpairedLink *receiving_link : {&link, &burst_link}) {
+            for (const auto &delivered : receiving_link->pop_delivered(time)) {
+                unsigned int received_update_number;
+                std::memcpy(&received_update_number, delivered.packet.data.data(), sizeof(received_update_number));
+                playout.insert(received_update_number, time);
+            }
+        }
+
+        bool starved = false;
+        double position = playout.get_position(time, starved);
+        if (position < 0) {
+            continue;
+        }
+        result.frames++;
+        result.starved_frames += starved;
+        result.backwards_frames += position < last_position;
+        last_position = position;
+
+        double age = time - position * tick_dt;
+        result.ages.push_back(age);
+        if (time >= 2 * settings.seconds / 3) {
+            settled_age_sum += age;
+            settled_frames++;
+        }
+    }
+
+    result.settled_age = settled_age_sum / std::max<uint64_t>(settled_frames, 1);
+    return result;
+}
+
+double percentile(const std::vector<double> &sorted_values, double p) {
+    if (sorted_values.empty()) {
+        return 0;
+    }
+    size_t index = std::min(sorted_values.size() - 1, static_cast<size_t>(p * sorted_values.size()));
+    return sorted_values[index];
+}
+
+void print_result(const std::string &scenario, const std::string &playout, PlayoutResult result) {
+    std::vector<double> &ages = result.ages;
+    std::sort(ages.begin(), ages.end());
+    double mean = 0;
+    for (double age : ages) {
+        mean += age;
+    }
+    mean /= std::max<size_t>(ages.size(), 1);
+    double frames = std::max<uint64_t>(result.frames, 1);
+
+    std::cout << fmt::format("{:>12} {:>12} | {:>8.1f} {:>8.1f} {:>8.1f} {:>10.1f} | {:>8.2f}% {:>9.2f}%", scenario,
+                             playout, 1e3 * mean, 1e3 * percentile(ages, 0.99), 1e3 * (ages.empty() ? 0 : ages.back()),
+                             1e3 * result.settled_age, 100 * result.starved_frames / frames,
+                             100 * result.backwards_frames / frames)
+              << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+
+    global_logger.remove_all_sinks();
+
+    BenchmarkSettings settings;
+    settings.seconds = argc > 1 ? std::stod(argv[1]) : 60;
+    settings.frame_rate = argc > 2 ? std::stod(argv[2]) : 240;
+    settings.tick_rate = argc > 3 ? std::stod(argv[3]) : 60;
+
+    LinkImpairment clean;
+    clean.latency = 0.05;
+
+    LinkImpairment normal_jitter = clean;
+    normal_jitter.jitter = 0.01;
+
+    LinkImpairment lossy = clean;
+    lossy.jitter = 0.02;
+    lossy.jitter_distribution = JitterDistribution::EXPONENTIAL;
+    lossy.drop_rate = 0.02;
+    lossy.duplicate_rate = 0.02;
+    lossy.reorder_rate = 0.02;
+
+    std::vector<Scenario> scenarios = {
+        {"clean", clean},
+        {"jitter", normal_jitter},
+        {"lossy", lossy},
+        {"burst", normal_jitter, true, lossy},
+    };
+
+    std::cout << fmt::format("{} s at {} fps, {} Hz ticks, 50 ms one way", settings.seconds, settings.frame_rate,
+                             settings.tick_rate)
+              << std::endl;
+    std::cout << fmt::format("{:>12} {:>12} | {:>8} {:>8} {:>8} {:>10} | {:>9} {:>10}", "scenario", "playout",
+                             "age ms", "p99 ms", "max ms", "settled ms", "starved", "backwards")
+              << std::endl;
+
+    // NOTE: the old timer's phase isn't aligned with the server, so it gets a random one
+    std::mt19937 random_engine(0);
+    std::uniform_real_distribution<double> phase_distribution(0, 1 / settings.tick_rate);
+    for (const Scenario &scenario : scenarios) {
+        print_result(scenario.name, "two oldest",
+                     run_benchmark(settings, scenario, TwoOldestPlayout(settings.tick_rate,
+                                                                         phase_distribution(random_engine))));
+        print_result(scenario.name, "jitter", run_benchmark(settings, scenario, JitterBufferPlayout(settings.tick_rate)));
+    }
+
+    return 0;
+}
@@ -0,0 +1,147 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include "../src/meta_program/meta_program.hpp"
+#include "../src/networking/loopback_transport/loopback_transport.hpp"
+
+#include "../src/utility/logger/logger.hpp"
+#include "../src/utility/meta_utils/meta_utils.hpp"
+
+#include "../src/system_logic/bot_session/bot_session.hpp"
+#include "../src/system_logic/server_simulation/server_simulation.hpp"
+
+// NOTE: runs the server and a number of bots in one process over a LoopbackHub, time only moves when the loop says
+// so, so apart from the wall clock time each server tick takes everything this reports (bandwidth, input latency, hits)
+// comes out the same on every run and on every machine, which makes it good for comparing two versions of the server.
+//
+// usage: loopback_benchmark [ticks] [one_way_latency_ms] [worker_threads] [tick_rate]
+
+struct BenchmarkResult {
+    unsigned int client_count;
+    std::vector<double> tick_durations;
+    BotStatistics totals;
+    double simulated_seconds;
+};
+
+BenchmarkResult run_benchmark(unsigned int client_count, unsigned int tick_count, unsigned int warmup_ticks, double dt,
+                              double one_way_latency, const ServerSimulationSettings &settings,
+                              meta_program::MetaProgram &mp) {
+    LoopbackHub hub(one_way_latency);
+    ServerSimulation simulation(settings, hub.get_server_transport(), mp);
+
+    BotBehaviour behaviour;
+    std::vector<std::unique_ptr<BotSession>> bots;
+    for (unsigned int bot_index = 0; bot_index < client_count; bot_index++) {
+        bots.push_back(std::make_unique<BotSession>(bot_index, behaviour, hub.connect_client(), mp));
+    }
+
+    BenchmarkResult result{client_count, {}, {}, 0};
+    result.tick_durations.reserve(tick_count);
+
+    BotStatistics totals_after_warmup;
+    for (unsigned int tick = 0; tick < warmup_ticks + tick_count; tick++) {
+        auto start = std::chrono::steady_clock::now();
+        simulation.tick(dt);
+        auto end = std::chrono::steady_clock::now();
+
+        // NOTE: bots tick on the same virtual time as the server, so with no latency a mouse update sent now is
+        // processed on the next server tick
+        for (auto &bot : bots) {
+            bot->tick(dt);
+        }
+        hub.advance_time(dt);
+
+        if (tick + 1 == warmup_ticks) {
+            for (const auto &bot : bots) {
+                totals_after_warmup += bot->get_statistics();
+            }
+        }
+        if (tick >= warmup_ticks) {
+            result.tick_durations.push_back(std::chrono::duration<double>(end - start).count());
+        }
+    }
+
+    for (const auto &bot : bots) {
+        result.totals += bot->get_statistics();
+    }
+    // NOTE: only the counters are meaningful after the subtraction, the max input latency covers the whole run
+    result.totals.bytes_sent -= totals_after_warmup.bytes_sent;
+    result.totals.bytes_received -= totals_after_warmup.bytes_received;
+    result.totals.input_latency_total -= totals_after_warmup.input_latency_total;
+    result.totals.input_latency_samples -= totals_after_warmup.input_latency_samples;
+    result.totals.shots_fired -= totals_after_warmup.shots_fired;
+    result.totals.hits -= totals_after_warmup.hits;
+    result.totals.misses -= totals_after_warmup.misses;
+    result.simulated_seconds = tick_count * dt;
+    return result;
+}
+
+double percentile(const std::vector<double> &sorted_values, double p) {
+    if (sorted_values.empty()) {
+        return 0;
+    }
+    size_t index = std::min(sorted_values.size() - 1, static_cast<size_t>(p * sorted_values.size()));
+    return sorted_values[index];
+}
+
+int main(int argc, char *argv[]) {
+
+    global_logger.remove_all_sinks();
+
+    unsigned int tick_count = argc > 1 ? std::stoul(argv[1]) : 3600;
+    double one_way_latency = argc > 2 ? std::stod(argv[2]) / 1000 : 0.025;
+    unsigned int worker_threads = argc > 3 ? std::stoul(argv[3]) : 3;
+    double tick_rate = argc > 4 ? std::stod(argv[4]) : 60;
+
+    double dt = 1 / tick_rate;
+    // NOTE: long enough for every bot to have joined and the delta baselines to have settled
+    unsigned int warmup_ticks = static_cast<unsigned int>(tick_rate);
+
+    meta_program::MetaProgram mp(meta_utils::meta_types.get_concrete_types());
+
+    ServerSimulationSettings settings;
+    settings.worker_threads = worker_threads;
+
+    std::cout << fmt::format("{} ticks at {} Hz, {} ms one way latency, {} worker threads", tick_count, tick_rate,
+                             one_way_latency * 1000, worker_threads)
+              << std::endl;
+    std::cout << fmt::format("{:>8} | {:>10} {:>10} {:>10} {:>10} | {:>12} {:>12} | {:>10} {:>10} | {:>8}", "clients",
+                             "mean us", "p50 us", "p99 us", "max us", "up B/s/cl", "down B/s/cl", "e2e ms", "e2e max",
+                             "hits")
+              << std::endl;
+
+    for (unsigned int client_count : {8u, 32u, 128u}) {
+        BenchmarkResult result =
+            run_benchmark(client_count, tick_count, warmup_ticks, dt, one_way_latency, settings, mp);
+
+        std::vector<double> &durations = result.tick_durations;
+        std::sort(durations.begin(), durations.end());
+        double mean = 0;
+        for (double duration : durations) {
+            mean += duration;
+        }
+        mean /= std::max<size_t>(durations.size(), 1);
+
+        const BotStatistics &totals = result.totals;
+        double per_client_seconds = result.simulated_seconds * client_count;
+        double mean_input_latency =
+            totals.input_latency_samples > 0 ? totals.input_latency_total / totals.input_latency_samples : 0;
+
+        std::cout << fmt::format(
+                         "{:>8} | {:>10.1f} {:>10.1f} {:>10.1f} {:>10.1f} | {:>12.0f} {:>12.0f} | {:>10.1f} {:>10.1f} | "
+                         "{:>8}",
+                         client_count, 1e6 * mean, 1e6 * percentile(durations, 0.5),
+                         1e6 * percentile(durations, 0.99), 1e6 * (durations.empty() ? 0 : durations.back()),
+                         totals.bytes_sent / per_client_seconds, totals.bytes_received / per_client_seconds,
+                         1000 * mean_input_latency, 1000 * totals.input_latency_max, totals.hits)
+                  << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,231 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include <glm/glm.hpp>
+
+#include "../src/utility/logger/logger.hpp"
+
+#include "../src/system_logic/hermite_interpolation/hermite_interpolation.hpp"
+#include "../src/system_logic/orbiter_history/orbiter_history.hpp"
+#include "../src/system_logic/rewind_history/rewind_history.hpp"
+#include "../src/system_logic/sphere_orbiter/sphere_orbiter.hpp"
+
+// NOTE: measures how well the target can be rewound to an arbitrary point in the rewind window. The target follows its
+// orbit and is sent off on a random one every so often like when it's hit, the server used to keep a snapshot of it
+// every tick and interpolate between the two around the point it rewinds to (linearly at first, with a hermite spline
+// now), this is compared against OrbiterHistory which only keeps the orbit changes and evaluates the orbit directly.
+// After every tick a batch of random points in the window is looked up with each and compared against the orbiter
+// stepped there from the tick before, points between a tick and an orbit change have no true position and are skipped.
+// Lookup speed is timed separately over the final window. Time is virtual.
+//
+// usage: orbiter_history_benchmark [seconds] [seconds_between_orbit_changes] [max_rewind_ticks]
+
+struct Snapshot {
+    glm::vec3 position;
+    glm::vec3 velocity;
+};
+
+struct ErrorResult {
+    double mean_distance = 0;
+    double max_distance = 0;
+    uint64_t samples = 0;
+
+    void add(const glm::vec3 &rewound, const glm::vec3 &actual) {
+        double distance = glm::length(rewound - actual);
+        mean_distance += distance;
+        max_distance = std::max(max_distance, distance);
+        samples++;
+    }
+
+    void finish() { mean_distance /= std::max<uint64_t>(samples, 1); }
+};
+
+// NOTE: the per tick history the server used to keep
+class SnapshotHistory {
+  public:
+    SnapshotHistory(unsigned int max_rewind_ticks, float tick_dt, bool hermite)
+        : update_number_to_snapshot(max_rewind_ticks), tick_dt(tick_dt), hermite(hermite) {}
+
+    void record(unsigned int update_number, const SphereOrbiter &sphere_orbiter, const glm::vec3 &position) {
+        update_number_to_snapshot.record(update_number) = {position, sphere_orbiter.get_velocity()};
+    }
+
+    bool get_position(double update_number, glm::vec3 &position) const {
+        unsigned int tick = static_cast<unsigned int>(update_number);
+        float t = static_cast<float>(update_number - tick);
+        const Snapshot *start = update_number_to_snapshot.get(tick);
+        const Snapshot *end = t == 0 ? start : update_number_to_snapshot.get(tick + 1);
+        if (start == nullptr or end == nullptr) {
+            return false;
+        }
+        position = hermite ? hermite_interpolate(start->position, start->velocity, end->position, end->velocity,
+                                                 tick_dt, t)
+                           : (1 - t) * start->position + t * end->position;
+        return true;
+    }
+
+    size_t get_memory_bytes() const {
+        return (update_number_to_snapshot.get_max_rewind_ticks() + 1) * sizeof(Snapshot);
+    }
+
+  private:
+    RewindHistory<Snapshot> update_number_to_snapshot;
+    float tick_dt;
+    bool hermite;
+};
+
+class AnalyticHistory {
+  public:
+    AnalyticHistory(unsigned int max_rewind_ticks, float tick_dt) : history(max_rewind_ticks), tick_dt(tick_dt) {}
+
+    void record(unsigned int update_number, const SphereOrbiter &sphere_orbiter, const glm::vec3 &) {
+        history.record(update_number, sphere_orbiter, tick_dt);
+    }
+
+    bool get_position(double update_number, glm::vec3 &position) const {
+        OrbiterState state;
+        if (not history.get_state(update_number, state)) {
+            return false;
+        }
+        position = state.position;
+        return true;
+    }
+
+    size_t get_memory_bytes() const { return history.get_segment_count() * sizeof(OrbiterHistory::Segment); }
+
+  private:
+    OrbiterHistory history;
+    float tick_dt;
+};
+
+struct HistoryResult {
+    ErrorResult error;
+    double mean_memory_bytes = 0;
+    size_t max_memory_bytes = 0;
+    double nanoseconds_per_lookup = 0;
+};
+
+struct BenchmarkSettings {
+    double seconds;
+    double seconds_between_orbit_changes;
+    unsigned int max_rewind_ticks;
+    double tick_rate = 60;
+    unsigned int lookups_per_tick = 16;
+};
+
+template <typename History>
+HistoryResult run_benchmark(const BenchmarkSettings &settings, History history) {
+    HistoryResult result;
+    float tick_dt = static_cast<float>(1 / settings.tick_rate);
+    SphereOrbiter sphere_orbiter(glm::vec3(0.0f, 1, 0), 8, glm::vec3(0.0f, 1.0f, 0.0f), glm::radians(90.0f), 0.0f);
+
+    // NOTE: seeded the same for every history so they all see the same run
+    std::mt19937 random_engine(0);
+    std::uniform_real_distribution<float> unit(0, 1);
+    std::exponential_distribution<double> change_distribution(1 / settings.seconds_between_orbit_changes);
+    double next_change_time = change_distribution(random_engine);
+
+    // NOTE: the orbiter as it was after each tick, and whether the orbit changed right after it
+    std::vector<SphereOrbiter> orbiters;
+    std::vector<bool> changed_after;
+
+    unsigned int tick_count = static_cast<unsigned int>(settings.seconds * settings.tick_rate);
+    uint64_t memory_bytes_sum = 0;
+    for (unsigned int update_number = 0; update_number < tick_count; update_number++) {
+        glm::vec3 position = sphere_orbiter.process(tick_dt);
+        history.record(update_number, sphere_orbiter, position);
+        orbiters.push_back(sphere_orbiter);
+        changed_after.push_back(false);
+
+        size_t memory_bytes = history.get_memory_bytes();
+        memory_bytes_sum += memory_bytes;
+        result.max_memory_bytes = std::max(result.max_memory_bytes, memory_bytes);
+
+        unsigned int oldest = update_number - std::min(update_number, settings.max_rewind_ticks);
+        for (unsigned int lookup = 0; lookup < settings.lookups_per_tick; lookup++) {
+            double rewind_update_number = oldest + unit(random_engine) * (update_number - oldest);
+            unsigned int tick = static_cast<unsigned int>(rewind_update_number);
+            if (changed_after[tick] and rewind_update_number != tick) {
+                continue;
+            }
+            glm::vec3 rewound;
+            if (history.get_position(rewind_update_number, rewound)) {
+                SphereOrbiter stepped = orbiters[tick];
+                result.error.add(rewound, stepped.process(static_cast<float>((rewind_update_number - tick) * tick_dt)));
+            }
+        }
+
+        if ((update_number + 1) * tick_dt >= next_change_time) {
+            sphere_orbiter.set_travel_axis(glm::normalize(glm::vec3(unit(random_engine) - 0.5f,
+                                                                    unit(random_engine) - 0.5f,
+                                                                    unit(random_engine) - 0.5f)));
+            sphere_orbiter.set_radius(4 + 4 * unit(random_engine));
+            sphere_orbiter.set_angular_speed(glm::radians(45.0f + 135.0f * unit(random_engine)));
+            changed_after.back() = true;
+            next_change_time += change_distribution(random_engine);
+        }
+    }
+    result.error.finish();
+    result.mean_memory_bytes = double(memory_bytes_sum) / std::max(tick_count, 1u);
+
+    std::vector<double> rewind_update_numbers;
+    unsigned int latest = tick_count - 1;
+    unsigned int oldest = latest - std::min(latest, settings.max_rewind_ticks);
+    for (unsigned int lookup = 0; lookup < 1000000; lookup++) {
+        rewind_update_numbers.push_back(oldest + unit(random_engine) * (latest - oldest));
+    }
+    // NOTE: summed so the lookups can't be optimized away
+    glm::vec3 sum(0);
+    auto start = std::chrono::steady_clock::now();
+    for (double rewind_update_number : rewind_update_numbers) {
+        glm::vec3 rewound(0);
+        history.get_position(rewind_update_number, rewound);
+        sum += rewound;
+    }
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    volatile float sink = sum.x + sum.y + sum.z;
+    (void)sink;
+    result.nanoseconds_per_lookup = 1e9 * elapsed / rewind_update_numbers.size();
+    return result;
+}
+
+void print_result(const std::string &history, const HistoryResult &result) {
+    std::cout << fmt::format("{:>16} | {:>9.4f} {:>9.4f} | {:>10.0f} {:>10} | {:>9.1f}", history,
+                             1e3 * result.error.mean_distance, 1e3 * result.error.max_distance,
+                             result.mean_memory_bytes, result.max_memory_bytes, result.nanoseconds_per_lookup)
+              << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+
+    global_logger.remove_all_sinks();
+
+    BenchmarkSettings settings;
+    settings.seconds = argc > 1 ? std::stod(argv[1]) : 600;
+    settings.seconds_between_orbit_changes = argc > 2 ? std::stod(argv[2]) : 2;
+    settings.max_rewind_ticks = argc > 3 ? std::stoul(argv[3]) : 60;
+    float tick_dt = static_cast<float>(1 / settings.tick_rate);
+
+    std::cout << fmt::format("{} s at {} Hz, {} tick rewind window, an orbit change every {} s on average",
+                             settings.seconds, settings.tick_rate, settings.max_rewind_ticks,
+                             settings.seconds_between_orbit_changes)
+              << std::endl;
+    std::cout << fmt::format("{:>16} | {:>9} {:>9} | {:>10} {:>10} | {:>9}", "history", "mean mm", "max mm",
+                             "mean bytes", "max bytes", "ns/lookup")
+              << std::endl;
+
+    print_result("snapshot linear",
+                 run_benchmark(settings, SnapshotHistory(settings.max_rewind_ticks, tick_dt, false)));
+    print_result("snapshot hermite",
+                 run_benchmark(settings, SnapshotHistory(settings.max_rewind_ticks, tick_dt, true)));
+    print_result("analytic", run_benchmark(settings, AnalyticHistory(settings.max_rewind_ticks, tick_dt)));
+
+    return 0;
+}
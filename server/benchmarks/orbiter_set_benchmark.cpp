@@ -0,0 +1,138 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include <glm/glm.hpp>
+
+#include "../src/utility/logger/logger.hpp"
+
+#include "../src/system_logic/orbiter_set/orbiter_set.hpp"
+#include "../src/system_logic/sphere_orbiter/sphere_orbiter.hpp"
+
+// NOTE: measures how long it takes to move a lot of targets for a tick. The same random orbiters are stepped one
+// SphereOrbiter at a time (process and get_velocity, like the server does for its one target) and with an OrbiterSet on
+// every backend the cpu supports, for 1k, 10k and 100k orbiters. After the run every orbiter's position is compared
+// against the per object loop, which uses the standard library's sine and cosine.
+//
+// usage: orbiter_set_benchmark [seconds] [tick_rate]
+
+struct BenchmarkSettings {
+    double seconds;
+    double tick_rate;
+};
+
+struct StepResult {
+    double seconds = 0;
+    std::vector<glm::vec3> positions;
+};
+
+std::vector<SphereOrbiter> make_orbiters(size_t orbiter_count) {
+    std::mt19937 random_engine(0);
+    std::uniform_real_distribution<float> unit(0, 1);
+    std::vector<SphereOrbiter> orbiters;
+    for (size_t i = 0; i < orbiter_count; i++) {
+        glm::vec3 center(32 * unit(random_engine) - 16, 4 * unit(random_engine), 32 * unit(random_engine) - 16);
+        glm::vec3 travel_axis(unit(random_engine) - 0.5f, unit(random_engine) - 0.5f, unit(random_engine) - 0.5f);
+        orbiters.emplace_back(center, 1 + 7 * unit(random_engine), glm::normalize(travel_axis),
+                              glm::radians(-180.0f + 360.0f * unit(random_engine)), 6.28f * unit(random_engine));
+    }
+    return orbiters;
+}
+
+unsigned int get_tick_count(const BenchmarkSettings &settings) {
+    return static_cast<unsigned int>(settings.seconds * settings.tick_rate);
+}
+
+StepResult run_per_object(const BenchmarkSettings &settings, std::vector<SphereOrbiter> orbiters) {
+    StepResult result;
+    std::vector<glm::vec3> positions(orbiters.size());
+    std::vector<glm::vec3> velocities(orbiters.size());
+    float dt = static_cast<float>(1 / settings.tick_rate);
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int tick = 0; tick < get_tick_count(settings); tick++) {
+        for (size_t i = 0; i < orbiters.size(); i++) {
+            positions[i] = orbiters[i].process(dt);
+            velocities[i] = orbiters[i].get_velocity();
+        }
+    }
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    result.positions = positions;
+    return result;
+}
+
+StepResult run_orbiter_set(const BenchmarkSettings &settings, const std::vector<SphereOrbiter> &orbiters,
+                           OrbiterSetBackend backend) {
+    StepResult result;
+    OrbiterSet orbiter_set;
+    orbiter_set.set_backend(backend);
+    for (const SphereOrbiter &sphere_orbiter : orbiters) {
+        orbiter_set.add(sphere_orbiter);
+    }
+    float dt = static_cast<float>(1 / settings.tick_rate);
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int tick = 0; tick < get_tick_count(settings); tick++) {
+        orbiter_set.process(dt);
+    }
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    for (size_t i = 0; i < orbiter_set.size(); i++) {
+        result.positions.push_back(orbiter_set.get_position(i));
+    }
+    return result;
+}
+
+void print_result(const BenchmarkSettings &settings, size_t orbiter_count, const std::string &method,
+                  const StepResult &result, const StepResult &per_object) {
+    double max_difference = 0;
+    for (size_t i = 0; i < result.positions.size(); i++) {
+        max_difference =
+            std::max(max_difference, double(glm::length(result.positions[i] - per_object.positions[i])));
+    }
+    double ticks = get_tick_count(settings);
+    std::cout << fmt::format("{:>8} {:>12} | {:>10.3f} {:>10.2f} | {:>8.1f}x | {:>10.4f}", orbiter_count, method,
+                             1e3 * result.seconds / ticks, 1e9 * result.seconds / (ticks * orbiter_count),
+                             per_object.seconds / result.seconds, 1e3 * max_difference)
+              << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+
+    global_logger.remove_all_sinks();
+
+    BenchmarkSettings settings;
+    settings.seconds = argc > 1 ? std::stod(argv[1]) : 10;
+    settings.tick_rate = argc > 2 ? std::stod(argv[2]) : 60;
+
+    std::cout << fmt::format("{} s at {} Hz", settings.seconds, settings.tick_rate) << std::endl;
+    std::cout << fmt::format("{:>8} {:>12} | {:>10} {:>10} | {:>9} | {:>10}", "orbiters", "method", "ms/tick",
+                             "ns/orbiter", "speedup", "max diff mm")
+              << std::endl;
+
+    std::vector<std::pair<std::string, OrbiterSetBackend>> backends = {
+        {"set scalar", OrbiterSetBackend::SCALAR},
+        {"set sse2", OrbiterSetBackend::SSE2},
+        {"set avx2", OrbiterSetBackend::AVX2},
+    };
+
+    for (size_t orbiter_count : {1000, 10000, 100000}) {
+        std::vector<SphereOrbiter> orbiters = make_orbiters(orbiter_count);
+        StepResult per_object = run_per_object(settings, orbiters);
+        print_result(settings, orbiter_count, "per object", per_object, per_object);
+        for (const auto &[method, backend] : backends) {
+            if (not OrbiterSet::is_backend_supported(backend)) {
+                std::cout << fmt::format("{:>8} {:>12} | not supported on this cpu", orbiter_count, method)
+                          << std::endl;
+                continue;
+            }
+            print_result(settings, orbiter_count, method, run_orbiter_set(settings, orbiters, backend), per_object);
+        }
+    }
+
+    return 0;
+}
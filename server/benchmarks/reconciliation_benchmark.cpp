@@ -0,0 +1,202 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <deque>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include "../src/graphics/fps_camera/fps_camera.hpp"
+
+#include "../src/utility/logger/logger.hpp"
+
+#include "../src/system_logic/sequence_buffer/sequence_buffer.hpp"
+
+// NOTE: measures what reconciling the camera costs the client per game update, the client keeps every mouse sample the
+// server hasn't processed yet and replays them on top of each game update, with a high frame rate and a long round trip
+// that's a lot of samples. The history the client used to keep (a vector that's filtered with erase_if on every game
+// update and then walked from the start) is compared against the SequenceBuffer it keeps now, which drops acknowledged
+// samples by moving its start and only walks the unacknowledged tail. Each is run once replaying the samples on a real
+// FPSCamera and once with a trivial replay so the cost of the history itself shows. Time is virtual, only the
+// reconciliations are timed.
+//
+// usage: reconciliation_benchmark [seconds] [frame_rate] [round_trip_ms] [tick_rate]
+
+struct LabelledMousePos {
+    unsigned int mouse_pos_update_number;
+    double x_pos;
+    double y_pos;
+};
+
+// NOTE: the client's history before SequenceBuffer, kept as the baseline
+class VectorMousePosHistory {
+  public:
+    void push_back(const LabelledMousePos &lmp) { history.push_back(lmp); }
+
+    template <typename SetLastMousePosition, typename Replay>
+    size_t reconcile(unsigned int last_processed, SetLastMousePosition set_last_mouse_position, Replay replay) {
+        std::erase_if(history, [&](const auto &lmp) { return lmp.mouse_pos_update_number < last_processed; });
+        size_t replayed = 0;
+        for (const auto &lmp : history) {
+            if (lmp.mouse_pos_update_number == last_processed) {
+                set_last_mouse_position(lmp);
+            } else if (lmp.mouse_pos_update_number > last_processed) {
+                replay(lmp);
+                replayed++;
+            }
+        }
+        return replayed;
+    }
+
+  private:
+    std::vector<LabelledMousePos> history;
+};
+
+class RingMousePosHistory {
+  public:
+    void push_back(const LabelledMousePos &lmp) { history.push_back(lmp); }
+
+    template <typename SetLastMousePosition, typename Replay>
+    size_t reconcile(unsigned int last_processed, SetLastMousePosition set_last_mouse_position, Replay replay) {
+        history.discard_before(last_processed);
+        if (const LabelledMousePos *lmp = history.get(last_processed)) {
+            set_last_mouse_position(*lmp);
+        }
+        size_t replayed = 0;
+        for (unsigned int n = std::max(last_processed + 1, history.get_first_sequence_number());
+             n < history.get_end_sequence_number(); n++) {
+            replay(history[n]);
+            replayed++;
+        }
+        return replayed;
+    }
+
+  private:
+    SequenceBuffer<LabelledMousePos> history{1024};
+};
+
+struct ReconciliationResult {
+    std::vector<double> durations;
+    double mean_samples_replayed = 0;
+};
+
+struct BenchmarkSettings {
+    double seconds;
+    double frame_rate;
+    double round_trip;
+    double tick_rate;
+};
+
+// NOTE: the client takes a mouse sample every frame and sends the newest one every tick, the game update that
+// acknowledges a send arrives a round trip later, which is when the history is reconciled
+template <typename History, typename Replay>
+ReconciliationResult run_benchmark(const BenchmarkSettings &settings, FPSCamera &fps_camera, Replay replay) {
+    History history;
+    ReconciliationResult result;
+
+    struct Send {
+        double time;
+        unsigned int mouse_pos_update_number;
+    };
+    std::deque<Send> sends_in_flight;
+
+    double dt = 1 / settings.frame_rate;
+    unsigned int frame_count = static_cast<unsigned int>(settings.seconds * settings.frame_rate);
+    double total_samples_replayed = 0;
+    auto set_last_mouse_position = [&](const LabelledMousePos &lmp) {
+        fps_camera.mouse.last_mouse_position_x = lmp.x_pos;
+        fps_camera.mouse.last_mouse_position_y = lmp.y_pos;
+    };
+
+    for (unsigned int frame = 0; frame < frame_count; frame++) {
+        double time = frame * dt;
+        // NOTE: sweeps wide enough to hit the pitch clamp now and then
+        history.push_back({frame, 400 * std::cos(time), 1500 * std::sin(0.7 * time)});
+
+        bool tick_happened = std::floor(time * settings.tick_rate) != std::floor((time - dt) * settings.tick_rate);
+        if (not tick_happened) {
+            continue;
+        }
+        sends_in_flight.push_back({time, frame});
+
+        // NOTE: the newest send a full round trip old is what the game update that just came in acknowledges
+        bool acknowledged_a_send = false;
+        unsigned int last_processed = 0;
+        while (not sends_in_flight.empty() and sends_in_flight.front().time <= time - settings.round_trip) {
+            last_processed = sends_in_flight.front().mouse_pos_update_number;
+            acknowledged_a_send = true;
+            sends_in_flight.pop_front();
+        }
+        if (not acknowledged_a_send) {
+            continue;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        size_t replayed = history.reconcile(last_processed, set_last_mouse_position, replay);
+        auto end = std::chrono::steady_clock::now();
+        result.durations.push_back(std::chrono::duration<double>(end - start).count());
+        total_samples_replayed += replayed;
+    }
+
+    result.mean_samples_replayed = total_samples_replayed / std::max<size_t>(result.durations.size(), 1);
+    return result;
+}
+
+double percentile(const std::vector<double> &sorted_values, double p) {
+    if (sorted_values.empty()) {
+        return 0;
+    }
+    size_t index = std::min(sorted_values.size() - 1, static_cast<size_t>(p * sorted_values.size()));
+    return sorted_values[index];
+}
+
+void print_result(const std::string &history, const std::string &replay, ReconciliationResult result) {
+    std::vector<double> &durations = result.durations;
+    std::sort(durations.begin(), durations.end());
+    double mean = 0;
+    for (double duration : durations) {
+        mean += duration;
+    }
+    mean /= std::max<size_t>(durations.size(), 1);
+
+    std::cout << fmt::format("{:>8} {:>8} | {:>10.2f} {:>10.2f} {:>10.2f} {:>10.2f} | {:>10.1f}", history, replay,
+                             1e6 * mean, 1e6 * percentile(durations, 0.5), 1e6 * percentile(durations, 0.99),
+                             1e6 * (durations.empty() ? 0 : durations.back()), result.mean_samples_replayed)
+              << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+
+    global_logger.remove_all_sinks();
+
+    BenchmarkSettings settings;
+    settings.seconds = argc > 1 ? std::stod(argv[1]) : 60;
+    settings.frame_rate = argc > 2 ? std::stod(argv[2]) : 240;
+    settings.round_trip = argc > 3 ? std::stod(argv[3]) / 1000 : 0.2;
+    settings.tick_rate = argc > 4 ? std::stod(argv[4]) : 60;
+
+    std::cout << fmt::format("{} s at {} fps, {} ms round trip, {} Hz ticks", settings.seconds, settings.frame_rate,
+                             settings.round_trip * 1000, settings.tick_rate)
+              << std::endl;
+    std::cout << fmt::format("{:>8} {:>8} | {:>10} {:>10} {:>10} {:>10} | {:>10}", "history", "replay", "mean us",
+                             "p50 us", "p99 us", "max us", "replayed")
+              << std::endl;
+
+    FPSCamera fps_camera;
+    double sensitivity = 1;
+    auto camera_replay = [&](const LabelledMousePos &lmp) {
+        fps_camera.mouse_callback(lmp.x_pos, lmp.y_pos, sensitivity);
+    };
+    // NOTE: volatile so the walk can't be optimized away
+    volatile double sink = 0;
+    auto trivial_replay = [&](const LabelledMousePos &lmp) { sink = sink + lmp.x_pos; };
+
+    print_result("vector", "camera", run_benchmark<VectorMousePosHistory>(settings, fps_camera, camera_replay));
+    print_result("ring", "camera", run_benchmark<RingMousePosHistory>(settings, fps_camera, camera_replay));
+    print_result("vector", "trivial", run_benchmark<VectorMousePosHistory>(settings, fps_camera, trivial_replay));
+    print_result("ring", "trivial", run_benchmark<RingMousePosHistory>(settings, fps_camera, trivial_replay));
+
+    return 0;
+}
@@ -0,0 +1,198 @@
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <enet/enet.h>
+
+#include <fmt/core.h>
+
+#include "../src/networking/enet_transport/enet_transport.hpp"
+#include "../src/networking/transport/transport.hpp"
+#include "../src/networking/udp_transport/udp_transport.hpp"
+
+#include "../src/utility/logger/logger.hpp"
+
+// NOTE: compares what it costs the server to move a tick's worth of packets with enet against the batched udp
+// backend, both run over localhost in this process. Every tick each client sends the server a mouse update sized
+// packet and the server sends each client a game update sized one, the time the server spends receiving and sending
+// (including the flush) is what's reported, along with how many of the packets made it.
+//
+// usage: transport_benchmark [ticks]
+
+constexpr uint16_t benchmark_port = 7787;
+constexpr size_t mouse_update_size = 20;
+constexpr size_t game_update_size = 25;
+
+// NOTE: the client side of enet, the client's Network isn't part of the server tree so enet is used directly
+class EnetClientTransport : public ClientTransport {
+  public:
+    explicit EnetClientTransport(uint16_t port) {
+        host = enet_host_create(nullptr, 1, 2, 0, 0);
+        ENetAddress address;
+        enet_address_set_host(&address, "127.0.0.1");
+        address.port = port;
+        peer = enet_host_connect(host, &address, 2, 0);
+    }
+    ~EnetClientTransport() override { enet_host_destroy(host); }
+
+    std::vector<PacketWithSize> get_network_events_received_since_last_tick() override {
+        std::vector<PacketWithSize> packets;
+        ENetEvent event;
+        while (enet_host_service(host, &event, 0) > 0) {
+            if (event.type == ENET_EVENT_TYPE_RECEIVE) {
+                PacketWithSize packet;
+                packet.data.assign(event.packet->data, event.packet->data + event.packet->dataLength);
+                packet.size = event.packet->dataLength;
+                packets.push_back(std::move(packet));
+                enet_packet_destroy(event.packet);
+            }
+        }
+        return packets;
+    }
+
+    void send_packet(const void *data, size_t size) override {
+        enet_peer_send(peer, 0, enet_packet_create(data, size, 0));
+        enet_host_flush(host);
+    }
+
+  private:
+    ENetHost *host;
+    ENetPeer *peer;
+};
+
+struct TransportResult {
+    bool connected_everyone = false;
+    double receive_microseconds_per_tick = 0;
+    double send_microseconds_per_tick = 0;
+    double up_delivered_fraction = 0;
+    double down_delivered_fraction = 0;
+};
+
+TransportResult run_benchmark(ServerTransport &server, std::vector<std::unique_ptr<ClientTransport>> &clients,
+                              unsigned int tick_count) {
+    TransportResult result;
+
+    // NOTE: give everyone a few seconds to connect, the clients are polled so that handshakes and hellos go out
+    auto connect_deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (std::chrono::steady_clock::now() < connect_deadline) {
+        server.get_network_events_since_last_tick();
+        for (auto &client : clients) {
+            client->get_network_events_received_since_last_tick();
+        }
+        if (server.get_connected_client_ids().size() == clients.size()) {
+            result.connected_everyone = true;
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    if (not result.connected_everyone) {
+        return result;
+    }
+
+    std::vector<char> mouse_update(mouse_update_size, 1);
+    std::vector<char> game_update(game_update_size, 2);
+    std::vector<unsigned int> client_ids = server.get_connected_client_ids();
+
+    uint64_t received_by_server = 0;
+    uint64_t received_by_clients = 0;
+    double receive_seconds = 0;
+    double send_seconds = 0;
+
+    for (unsigned int tick = 0; tick < tick_count; tick++) {
+        for (auto &client : clients) {
+            client->send_packet(mouse_update.data(), mouse_update.size());
+        }
+        // NOTE: long enough for localhost to deliver everything, it isn't part of what's measured
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+        auto receive_start = std::chrono::steady_clock::now();
+        received_by_server += server.get_network_events_since_last_tick().size();
+        auto send_start = std::chrono::steady_clock::now();
+        for (unsigned int client_id : client_ids) {
+            server.unreliable_send(client_id, game_update.data(), game_update.size());
+        }
+        server.flush();
+        auto send_end = std::chrono::steady_clock::now();
+
+        receive_seconds += std::chrono::duration<double>(send_start - receive_start).count();
+        send_seconds += std::chrono::duration<double>(send_end - send_start).count();
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        for (auto &client : clients) {
+            received_by_clients += client->get_network_events_received_since_last_tick().size();
+        }
+    }
+
+    double packets_per_direction = double(tick_count) * clients.size();
+    result.receive_microseconds_per_tick = 1e6 * receive_seconds / tick_count;
+    result.send_microseconds_per_tick = 1e6 * send_seconds / tick_count;
+    result.up_delivered_fraction = received_by_server / packets_per_direction;
+    result.down_delivered_fraction = received_by_clients / packets_per_direction;
+    return result;
+}
+
+void print_result(const std::string &backend, size_t client_count, const TransportResult &result) {
+    if (not result.connected_everyone) {
+        std::cout << fmt::format("{:>8} {:>8} | not every client managed to connect", backend, client_count)
+                  << std::endl;
+        return;
+    }
+    std::cout << fmt::format("{:>8} {:>8} | {:>12.1f} {:>12.1f} | {:>9.2f}% {:>9.2f}%", backend, client_count,
+                             result.receive_microseconds_per_tick, result.send_microseconds_per_tick,
+                             100 * result.up_delivered_fraction, 100 * result.down_delivered_fraction)
+              << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+
+    global_logger.remove_all_sinks();
+
+    unsigned int tick_count = argc > 1 ? std::stoul(argv[1]) : 600;
+
+    enet_initialize();
+
+    std::cout << fmt::format("{} ticks, {} byte packets up and {} byte packets down per client per tick", tick_count,
+                             mouse_update_size, game_update_size)
+              << std::endl;
+    std::cout << fmt::format("{:>8} {:>8} | {:>12} {:>12} | {:>10} {:>10}", "backend", "clients", "receive us",
+                             "send us", "up", "down")
+              << std::endl;
+
+    for (size_t client_count : {100, 250, 500}) {
+        {
+            EnetServerTransport server(benchmark_port);
+            server.initialize_network();
+
+            std::vector<std::unique_ptr<ClientTransport>> clients;
+            for (size_t i = 0; i < client_count; i++) {
+                clients.push_back(std::make_unique<EnetClientTransport>(benchmark_port));
+            }
+            print_result("enet", client_count, run_benchmark(server, clients, tick_count));
+        }
+
+#ifdef __linux__
+        {
+            UdpServerTransport server(benchmark_port);
+            server.initialize_network();
+
+            std::vector<std::unique_ptr<ClientTransport>> clients;
+            for (size_t i = 0; i < client_count; i++) {
+                auto client = std::make_unique<UdpClientTransport>("127.0.0.1", benchmark_port);
+                client->initialize_network();
+                client->attempt_to_connect_to_server();
+                clients.push_back(std::move(client));
+            }
+            print_result("udp", client_count, run_benchmark(server, clients, tick_count));
+        }
+#endif
+    }
+
+    enet_deinitialize();
+
+    return 0;
+}
@@ -307,6 +307,11 @@ public:
                 case PacketType::MOUSE_UPDATE: return "PacketType::MOUSE_UPDATE";
                 case PacketType::GAME_UPDATE: return "PacketType::GAME_UPDATE";
                 case PacketType::SOUND_UPDATE: return "PacketType::SOUND_UPDATE";
+                case PacketType::GAME_UPDATE_QUANTIZED: return "PacketType::GAME_UPDATE_QUANTIZED";
+                case PacketType::MOUSE_UPDATE_QUANTIZED: return "PacketType::MOUSE_UPDATE_QUANTIZED";
+                case PacketType::GAME_UPDATE_DELTA: return "PacketType::GAME_UPDATE_DELTA";
+                case PacketType::GAME_FRAME: return "PacketType::GAME_FRAME";
+                case PacketType::MOUSE_UPDATE_WINDOW: return "PacketType::MOUSE_UPDATE_WINDOW";
                 default: return "<unknown PacketType>";
             }
 
@@ -315,6 +320,11 @@ public:
         if (s == "PacketType::MOUSE_UPDATE") return PacketType::MOUSE_UPDATE;
             if (s == "PacketType::GAME_UPDATE") return PacketType::GAME_UPDATE;
             if (s == "PacketType::SOUND_UPDATE") return PacketType::SOUND_UPDATE;
+            if (s == "PacketType::GAME_UPDATE_QUANTIZED") return PacketType::GAME_UPDATE_QUANTIZED;
+            if (s == "PacketType::MOUSE_UPDATE_QUANTIZED") return PacketType::MOUSE_UPDATE_QUANTIZED;
+            if (s == "PacketType::GAME_UPDATE_DELTA") return PacketType::GAME_UPDATE_DELTA;
+            if (s == "PacketType::GAME_FRAME") return PacketType::GAME_FRAME;
+            if (s == "PacketType::MOUSE_UPDATE_WINDOW") return PacketType::MOUSE_UPDATE_WINDOW;
             return static_cast<PacketType>(0); // default fallback
 
     }
@@ -344,6 +354,11 @@ public:
                 case PacketType::MOUSE_UPDATE: return "PacketType::MOUSE_UPDATE";
                 case PacketType::GAME_UPDATE: return "PacketType::GAME_UPDATE";
                 case PacketType::SOUND_UPDATE: return "PacketType::SOUND_UPDATE";
+                case PacketType::GAME_UPDATE_QUANTIZED: return "PacketType::GAME_UPDATE_QUANTIZED";
+                case PacketType::MOUSE_UPDATE_QUANTIZED: return "PacketType::MOUSE_UPDATE_QUANTIZED";
+                case PacketType::GAME_UPDATE_DELTA: return "PacketType::GAME_UPDATE_DELTA";
+                case PacketType::GAME_FRAME: return "PacketType::GAME_FRAME";
+                case PacketType::MOUSE_UPDATE_WINDOW: return "PacketType::MOUSE_UPDATE_WINDOW";
                 default: return "<unknown PacketType>";
             }
         };
@@ -368,6 +383,11 @@ public:
             if (s == "PacketType::MOUSE_UPDATE") return PacketType::MOUSE_UPDATE;
             if (s == "PacketType::GAME_UPDATE") return PacketType::GAME_UPDATE;
             if (s == "PacketType::SOUND_UPDATE") return PacketType::SOUND_UPDATE;
+            if (s == "PacketType::GAME_UPDATE_QUANTIZED") return PacketType::GAME_UPDATE_QUANTIZED;
+            if (s == "PacketType::MOUSE_UPDATE_QUANTIZED") return PacketType::MOUSE_UPDATE_QUANTIZED;
+            if (s == "PacketType::GAME_UPDATE_DELTA") return PacketType::GAME_UPDATE_DELTA;
+            if (s == "PacketType::GAME_FRAME") return PacketType::GAME_FRAME;
+            if (s == "PacketType::MOUSE_UPDATE_WINDOW") return PacketType::MOUSE_UPDATE_WINDOW;
             return static_cast<PacketType>(0); // default fallback
         };
                     obj.type = conv(value_str);
@@ -638,9 +658,18 @@ public:
     std::string MouseUpdate_to_string(MouseUpdate obj) {
         std::ostringstream oss;
             oss << "{";
+            { auto conv = [](const unsigned int &v) { return std::to_string(v); };
+              oss << "client_id=" << conv(obj.client_id); }
+            oss << ", ";
             { auto conv = [](const unsigned int &v) { return std::to_string(v); };
               oss << "mouse_pos_update_number=" << conv(obj.mouse_pos_update_number); }
             oss << ", ";
+            { auto conv = [](const bool &v) { return v ? "true" : "false"; };
+              oss << "has_received_game_update=" << conv(obj.has_received_game_update); }
+            oss << ", ";
+            { auto conv = [](const unsigned int &v) { return std::to_string(v); };
+              oss << "last_received_game_update_number=" << conv(obj.last_received_game_update_number); }
+            oss << ", ";
             { auto conv = [](const unsigned int &v) { return std::to_string(v); };
               oss << "last_applied_game_update_number_before_firing_entity_interpolation=" << conv(obj.last_applied_game_update_number_before_firing_entity_interpolation); }
             oss << ", ";
@@ -650,6 +679,9 @@ public:
             { auto conv = [](const double &v) { return std::to_string(v); };
               oss << "subtick_percentage_when_fire_pressed=" << conv(obj.subtick_percentage_when_fire_pressed); }
             oss << ", ";
+            { auto conv = [](const double &v) { return std::to_string(v); };
+              oss << "entity_extrapolation_when_fire_pressed=" << conv(obj.entity_extrapolation_when_fire_pressed); }
+            oss << ", ";
             { auto conv = [](const double &v) { return std::to_string(v); };
               oss << "subtick_x_pos_before_firing=" << conv(obj.subtick_x_pos_before_firing); }
             oss << ", ";
@@ -676,6 +708,14 @@ public:
             std::string trimmed = s.substr(1, s.size() - 2); // remove {}
             std::istringstream iss(trimmed);
             std::string token;
+            if (std::getline(iss, token, ',')) {
+                auto pos = token.find('=');
+                if (pos != std::string::npos) {
+                    std::string value_str = token.substr(pos + 1);
+                    auto conv = [](const std::string &s) { return static_cast<unsigned int>(std::stoul(s)); };
+                    obj.client_id = conv(value_str);
+                }
+            }
             if (std::getline(iss, token, ',')) {
                 auto pos = token.find('=');
                 if (pos != std::string::npos) {
@@ -684,6 +724,22 @@ public:
                     obj.mouse_pos_update_number = conv(value_str);
                 }
             }
+            if (std::getline(iss, token, ',')) {
+                auto pos = token.find('=');
+                if (pos != std::string::npos) {
+                    std::string value_str = token.substr(pos + 1);
+                    auto conv = [](const std::string &s) { return s == "true"; };
+                    obj.has_received_game_update = conv(value_str);
+                }
+            }
+            if (std::getline(iss, token, ',')) {
+                auto pos = token.find('=');
+                if (pos != std::string::npos) {
+                    std::string value_str = token.substr(pos + 1);
+                    auto conv = [](const std::string &s) { return static_cast<unsigned int>(std::stoul(s)); };
+                    obj.last_received_game_update_number = conv(value_str);
+                }
+            }
             if (std::getline(iss, token, ',')) {
                 auto pos = token.find('=');
                 if (pos != std::string::npos) {
@@ -708,6 +764,14 @@ public:
                     obj.subtick_percentage_when_fire_pressed = conv(value_str);
                 }
             }
+            if (std::getline(iss, token, ',')) {
+                auto pos = token.find('=');
+                if (pos != std::string::npos) {
+                    std::string value_str = token.substr(pos + 1);
+                    auto conv = [](const std::string &s) { return std::stod(s); };
+                    obj.entity_extrapolation_when_fire_pressed = conv(value_str);
+                }
+            }
             if (std::getline(iss, token, ',')) {
                 auto pos = token.find('=');
                 if (pos != std::string::npos) {
@@ -761,9 +825,18 @@ public:
     }
     std::vector<uint8_t> serialize_MouseUpdate(MouseUpdate obj) {
         std::vector<uint8_t> buffer;
+            { auto ser = [](const unsigned int &v) {   std::vector<uint8_t> buf(sizeof(unsigned int));   std::memcpy(buf.data(), &v, sizeof(unsigned int));   return buf; };
+              auto bytes = ser(obj.client_id);
+              buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
             { auto ser = [](const unsigned int &v) {   std::vector<uint8_t> buf(sizeof(unsigned int));   std::memcpy(buf.data(), &v, sizeof(unsigned int));   return buf; };
               auto bytes = ser(obj.mouse_pos_update_number);
               buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
+            { auto ser = [](const bool &v) {   std::vector<uint8_t> buf(1);   buf[0] = v ? 1 : 0;   return buf; };
+              auto bytes = ser(obj.has_received_game_update);
+              buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
+            { auto ser = [](const unsigned int &v) {   std::vector<uint8_t> buf(sizeof(unsigned int));   std::memcpy(buf.data(), &v, sizeof(unsigned int));   return buf; };
+              auto bytes = ser(obj.last_received_game_update_number);
+              buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
             { auto ser = [](const unsigned int &v) {   std::vector<uint8_t> buf(sizeof(unsigned int));   std::memcpy(buf.data(), &v, sizeof(unsigned int));   return buf; };
               auto bytes = ser(obj.last_applied_game_update_number_before_firing_entity_interpolation);
               buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
@@ -773,6 +846,9 @@ public:
             { auto ser = [](const double &v) {   std::vector<uint8_t> buf(sizeof(double));   std::memcpy(buf.data(), &v, sizeof(double));   return buf; };
               auto bytes = ser(obj.subtick_percentage_when_fire_pressed);
               buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
+            { auto ser = [](const double &v) {   std::vector<uint8_t> buf(sizeof(double));   std::memcpy(buf.data(), &v, sizeof(double));   return buf; };
+              auto bytes = ser(obj.entity_extrapolation_when_fire_pressed);
+              buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
             { auto ser = [](const double &v) {   std::vector<uint8_t> buf(sizeof(double));   std::memcpy(buf.data(), &v, sizeof(double));   return buf; };
               auto bytes = ser(obj.subtick_x_pos_before_firing);
               buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
@@ -796,14 +872,22 @@ public:
     }
     size_t size_when_serialized_MouseUpdate(MouseUpdate obj) {
         size_t total = 0;
+            { auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
+              total += size_fn(obj.client_id); }
             { auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
               total += size_fn(obj.mouse_pos_update_number); }
+            { auto size_fn = [](const bool &v) { return sizeof(uint8_t); };
+              total += size_fn(obj.has_received_game_update); }
+            { auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
+              total += size_fn(obj.last_received_game_update_number); }
             { auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
               total += size_fn(obj.last_applied_game_update_number_before_firing_entity_interpolation); }
             { auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
               total += size_fn(obj.last_applied_game_update_number_before_firing_camera_cpsr); }
             { auto size_fn = [](const double &v) { return sizeof(double); };
               total += size_fn(obj.subtick_percentage_when_fire_pressed); }
+            { auto size_fn = [](const double &v) { return sizeof(double); };
+              total += size_fn(obj.entity_extrapolation_when_fire_pressed); }
             { auto size_fn = [](const double &v) { return sizeof(double); };
               total += size_fn(obj.subtick_x_pos_before_firing); }
             { auto size_fn = [](const double &v) { return sizeof(double); };
@@ -822,6 +906,14 @@ public:
     MouseUpdate deserialize_MouseUpdate(std::vector<uint8_t> &buffer) {
         MouseUpdate obj;
             size_t offset = 0;
+            { auto deser = [](const std::vector<uint8_t> &buf) {   unsigned int v;   std::memcpy(&v, buf.data(), sizeof(unsigned int));   return v; };
+              auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
+              size_t len = size_fn(obj.client_id);
+              if (offset + len > buffer.size()) return obj;
+              std::vector<uint8_t> slice(buffer.begin() + offset, buffer.begin() + offset + len);
+              obj.client_id = deser(slice);
+              offset += len;
+            }
             { auto deser = [](const std::vector<uint8_t> &buf) {   unsigned int v;   std::memcpy(&v, buf.data(), sizeof(unsigned int));   return v; };
               auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
               size_t len = size_fn(obj.mouse_pos_update_number);
@@ -830,6 +922,22 @@ public:
               obj.mouse_pos_update_number = deser(slice);
               offset += len;
             }
+            { auto deser = [](const std::vector<uint8_t> &buf) {   return buf[0] != 0; };
+              auto size_fn = [](const bool &v) { return sizeof(uint8_t); };
+              size_t len = size_fn(obj.has_received_game_update);
+              if (offset + len > buffer.size()) return obj;
+              std::vector<uint8_t> slice(buffer.begin() + offset, buffer.begin() + offset + len);
+              obj.has_received_game_update = deser(slice);
+              offset += len;
+            }
+            { auto deser = [](const std::vector<uint8_t> &buf) {   unsigned int v;   std::memcpy(&v, buf.data(), sizeof(unsigned int));   return v; };
+              auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
+              size_t len = size_fn(obj.last_received_game_update_number);
+              if (offset + len > buffer.size()) return obj;
+              std::vector<uint8_t> slice(buffer.begin() + offset, buffer.begin() + offset + len);
+              obj.last_received_game_update_number = deser(slice);
+              offset += len;
+            }
             { auto deser = [](const std::vector<uint8_t> &buf) {   unsigned int v;   std::memcpy(&v, buf.data(), sizeof(unsigned int));   return v; };
               auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
               size_t len = size_fn(obj.last_applied_game_update_number_before_firing_entity_interpolation);
@@ -854,6 +962,14 @@ public:
               obj.subtick_percentage_when_fire_pressed = deser(slice);
               offset += len;
             }
+            { auto deser = [](const std::vector<uint8_t> &buf) {   double v;   std::memcpy(&v, buf.data(), sizeof(double));   return v; };
+              auto size_fn = [](const double &v) { return sizeof(double); };
+              size_t len = size_fn(obj.entity_extrapolation_when_fire_pressed);
+              if (offset + len > buffer.size()) return obj;
+              std::vector<uint8_t> slice(buffer.begin() + offset, buffer.begin() + offset + len);
+              obj.entity_extrapolation_when_fire_pressed = deser(slice);
+              offset += len;
+            }
             { auto deser = [](const std::vector<uint8_t> &buf) {   double v;   std::memcpy(&v, buf.data(), sizeof(double));   return v; };
               auto size_fn = [](const double &v) { return sizeof(double); };
               size_t len = size_fn(obj.subtick_x_pos_before_firing);
@@ -908,6 +1024,9 @@ public:
     std::string GameUpdate_to_string(GameUpdate obj) {
         std::ostringstream oss;
             oss << "{";
+            { auto conv = [](const unsigned int &v) { return std::to_string(v); };
+              oss << "client_id=" << conv(obj.client_id); }
+            oss << ", ";
             { auto conv = [](const unsigned int &v) { return std::to_string(v); };
               oss << "last_processed_mouse_pos_update_number=" << conv(obj.last_processed_mouse_pos_update_number); }
             oss << ", ";
@@ -928,6 +1047,15 @@ public:
             oss << ", ";
             { auto conv = [](const double &v) { return std::to_string(v); };
               oss << "target_z_pos=" << conv(obj.target_z_pos); }
+            oss << ", ";
+            { auto conv = [](const double &v) { return std::to_string(v); };
+              oss << "target_x_vel=" << conv(obj.target_x_vel); }
+            oss << ", ";
+            { auto conv = [](const double &v) { return std::to_string(v); };
+              oss << "target_y_vel=" << conv(obj.target_y_vel); }
+            oss << ", ";
+            { auto conv = [](const double &v) { return std::to_string(v); };
+              oss << "target_z_vel=" << conv(obj.target_z_vel); }
             oss << "}";
             return oss.str();
 
@@ -937,6 +1065,14 @@ public:
             std::string trimmed = s.substr(1, s.size() - 2); // remove {}
             std::istringstream iss(trimmed);
             std::string token;
+            if (std::getline(iss, token, ',')) {
+                auto pos = token.find('=');
+                if (pos != std::string::npos) {
+                    std::string value_str = token.substr(pos + 1);
+                    auto conv = [](const std::string &s) { return static_cast<unsigned int>(std::stoul(s)); };
+                    obj.client_id = conv(value_str);
+                }
+            }
             if (std::getline(iss, token, ',')) {
                 auto pos = token.find('=');
                 if (pos != std::string::npos) {
@@ -993,11 +1129,38 @@ public:
                     obj.target_z_pos = conv(value_str);
                 }
             }
+            if (std::getline(iss, token, ',')) {
+                auto pos = token.find('=');
+                if (pos != std::string::npos) {
+                    std::string value_str = token.substr(pos + 1);
+                    auto conv = [](const std::string &s) { return std::stod(s); };
+                    obj.target_x_vel = conv(value_str);
+                }
+            }
+            if (std::getline(iss, token, ',')) {
+                auto pos = token.find('=');
+                if (pos != std::string::npos) {
+                    std::string value_str = token.substr(pos + 1);
+                    auto conv = [](const std::string &s) { return std::stod(s); };
+                    obj.target_y_vel = conv(value_str);
+                }
+            }
+            if (std::getline(iss, token, ',')) {
+                auto pos = token.find('=');
+                if (pos != std::string::npos) {
+                    std::string value_str = token.substr(pos + 1);
+                    auto conv = [](const std::string &s) { return std::stod(s); };
+                    obj.target_z_vel = conv(value_str);
+                }
+            }
             return obj;
 
     }
     std::vector<uint8_t> serialize_GameUpdate(GameUpdate obj) {
         std::vector<uint8_t> buffer;
+            { auto ser = [](const unsigned int &v) {   std::vector<uint8_t> buf(sizeof(unsigned int));   std::memcpy(buf.data(), &v, sizeof(unsigned int));   return buf; };
+              auto bytes = ser(obj.client_id);
+              buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
             { auto ser = [](const unsigned int &v) {   std::vector<uint8_t> buf(sizeof(unsigned int));   std::memcpy(buf.data(), &v, sizeof(unsigned int));   return buf; };
               auto bytes = ser(obj.last_processed_mouse_pos_update_number);
               buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
@@ -1019,11 +1182,22 @@ public:
             { auto ser = [](const double &v) {   std::vector<uint8_t> buf(sizeof(double));   std::memcpy(buf.data(), &v, sizeof(double));   return buf; };
               auto bytes = ser(obj.target_z_pos);
               buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
+            { auto ser = [](const double &v) {   std::vector<uint8_t> buf(sizeof(double));   std::memcpy(buf.data(), &v, sizeof(double));   return buf; };
+              auto bytes = ser(obj.target_x_vel);
+              buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
+            { auto ser = [](const double &v) {   std::vector<uint8_t> buf(sizeof(double));   std::memcpy(buf.data(), &v, sizeof(double));   return buf; };
+              auto bytes = ser(obj.target_y_vel);
+              buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
+            { auto ser = [](const double &v) {   std::vector<uint8_t> buf(sizeof(double));   std::memcpy(buf.data(), &v, sizeof(double));   return buf; };
+              auto bytes = ser(obj.target_z_vel);
+              buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
             return buffer;
 
     }
     size_t size_when_serialized_GameUpdate(GameUpdate obj) {
         size_t total = 0;
+            { auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
+              total += size_fn(obj.client_id); }
             { auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
               total += size_fn(obj.last_processed_mouse_pos_update_number); }
             { auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
@@ -1038,12 +1212,26 @@ public:
               total += size_fn(obj.target_y_pos); }
             { auto size_fn = [](const double &v) { return sizeof(double); };
               total += size_fn(obj.target_z_pos); }
+            { auto size_fn = [](const double &v) { return sizeof(double); };
+              total += size_fn(obj.target_x_vel); }
+            { auto size_fn = [](const double &v) { return sizeof(double); };
+              total += size_fn(obj.target_y_vel); }
+            { auto size_fn = [](const double &v) { return sizeof(double); };
+              total += size_fn(obj.target_z_vel); }
             return total;
 
     }
     GameUpdate deserialize_GameUpdate(std::vector<uint8_t> &buffer) {
         GameUpdate obj;
             size_t offset = 0;
+            { auto deser = [](const std::vector<uint8_t> &buf) {   unsigned int v;   std::memcpy(&v, buf.data(), sizeof(unsigned int));   return v; };
+              auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
+              size_t len = size_fn(obj.client_id);
+              if (offset + len > buffer.size()) return obj;
+              std::vector<uint8_t> slice(buffer.begin() + offset, buffer.begin() + offset + len);
+              obj.client_id = deser(slice);
+              offset += len;
+            }
             { auto deser = [](const std::vector<uint8_t> &buf) {   unsigned int v;   std::memcpy(&v, buf.data(), sizeof(unsigned int));   return v; };
               auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
               size_t len = size_fn(obj.last_processed_mouse_pos_update_number);
@@ -1100,6 +1288,30 @@ public:
               obj.target_z_pos = deser(slice);
               offset += len;
             }
+            { auto deser = [](const std::vector<uint8_t> &buf) {   double v;   std::memcpy(&v, buf.data(), sizeof(double));   return v; };
+              auto size_fn = [](const double &v) { return sizeof(double); };
+              size_t len = size_fn(obj.target_x_vel);
+              if (offset + len > buffer.size()) return obj;
+              std::vector<uint8_t> slice(buffer.begin() + offset, buffer.begin() + offset + len);
+              obj.target_x_vel = deser(slice);
+              offset += len;
+            }
+            { auto deser = [](const std::vector<uint8_t> &buf) {   double v;   std::memcpy(&v, buf.data(), sizeof(double));   return v; };
+              auto size_fn = [](const double &v) { return sizeof(double); };
+              size_t len = size_fn(obj.target_y_vel);
+              if (offset + len > buffer.size()) return obj;
+              std::vector<uint8_t> slice(buffer.begin() + offset, buffer.begin() + offset + len);
+              obj.target_y_vel = deser(slice);
+              offset += len;
+            }
+            { auto deser = [](const std::vector<uint8_t> &buf) {   double v;   std::memcpy(&v, buf.data(), sizeof(double));   return v; };
+              auto size_fn = [](const double &v) { return sizeof(double); };
+              size_t len = size_fn(obj.target_z_vel);
+              if (offset + len > buffer.size()) return obj;
+              std::vector<uint8_t> slice(buffer.begin() + offset, buffer.begin() + offset + len);
+              obj.target_z_vel = deser(slice);
+              offset += len;
+            }
             return obj;
 
     }
@@ -1274,6 +1486,11 @@ public:
                 case PacketType::MOUSE_UPDATE: return "PacketType::MOUSE_UPDATE";
                 case PacketType::GAME_UPDATE: return "PacketType::GAME_UPDATE";
                 case PacketType::SOUND_UPDATE: return "PacketType::SOUND_UPDATE";
+                case PacketType::GAME_UPDATE_QUANTIZED: return "PacketType::GAME_UPDATE_QUANTIZED";
+                case PacketType::MOUSE_UPDATE_QUANTIZED: return "PacketType::MOUSE_UPDATE_QUANTIZED";
+                case PacketType::GAME_UPDATE_DELTA: return "PacketType::GAME_UPDATE_DELTA";
+                case PacketType::GAME_FRAME: return "PacketType::GAME_FRAME";
+                case PacketType::MOUSE_UPDATE_WINDOW: return "PacketType::MOUSE_UPDATE_WINDOW";
                 default: return "<unknown PacketType>";
             }
         };
@@ -1289,9 +1506,18 @@ public:
             { auto conv = [=](const MouseUpdate& obj) -> std::string {
             std::ostringstream oss;
             oss << "{";
+            { auto conv = [](const unsigned int &v) { return std::to_string(v); };
+              oss << "client_id=" << conv(obj.client_id); }
+            oss << ", ";
             { auto conv = [](const unsigned int &v) { return std::to_string(v); };
               oss << "mouse_pos_update_number=" << conv(obj.mouse_pos_update_number); }
             oss << ", ";
+            { auto conv = [](const bool &v) { return v ? "true" : "false"; };
+              oss << "has_received_game_update=" << conv(obj.has_received_game_update); }
+            oss << ", ";
+            { auto conv = [](const unsigned int &v) { return std::to_string(v); };
+              oss << "last_received_game_update_number=" << conv(obj.last_received_game_update_number); }
+            oss << ", ";
             { auto conv = [](const unsigned int &v) { return std::to_string(v); };
               oss << "last_applied_game_update_number_before_firing_entity_interpolation=" << conv(obj.last_applied_game_update_number_before_firing_entity_interpolation); }
             oss << ", ";
@@ -1301,6 +1527,9 @@ public:
             { auto conv = [](const double &v) { return std::to_string(v); };
               oss << "subtick_percentage_when_fire_pressed=" << conv(obj.subtick_percentage_when_fire_pressed); }
             oss << ", ";
+            { auto conv = [](const double &v) { return std::to_string(v); };
+              oss << "entity_extrapolation_when_fire_pressed=" << conv(obj.entity_extrapolation_when_fire_pressed); }
+            oss << ", ";
             { auto conv = [](const double &v) { return std::to_string(v); };
               oss << "subtick_x_pos_before_firing=" << conv(obj.subtick_x_pos_before_firing); }
             oss << ", ";
@@ -1348,6 +1577,11 @@ public:
             if (s == "PacketType::MOUSE_UPDATE") return PacketType::MOUSE_UPDATE;
             if (s == "PacketType::GAME_UPDATE") return PacketType::GAME_UPDATE;
             if (s == "PacketType::SOUND_UPDATE") return PacketType::SOUND_UPDATE;
+            if (s == "PacketType::GAME_UPDATE_QUANTIZED") return PacketType::GAME_UPDATE_QUANTIZED;
+            if (s == "PacketType::MOUSE_UPDATE_QUANTIZED") return PacketType::MOUSE_UPDATE_QUANTIZED;
+            if (s == "PacketType::GAME_UPDATE_DELTA") return PacketType::GAME_UPDATE_DELTA;
+            if (s == "PacketType::GAME_FRAME") return PacketType::GAME_FRAME;
+            if (s == "PacketType::MOUSE_UPDATE_WINDOW") return PacketType::MOUSE_UPDATE_WINDOW;
             return static_cast<PacketType>(0); // default fallback
         };
                     obj.type = conv(value_str);
@@ -1375,6 +1609,14 @@ public:
             std::string trimmed = s.substr(1, s.size() - 2); // remove {}
             std::istringstream iss(trimmed);
             std::string token;
+            if (std::getline(iss, token, ',')) {
+                auto pos = token.find('=');
+                if (pos != std::string::npos) {
+                    std::string value_str = token.substr(pos + 1);
+                    auto conv = [](const std::string &s) { return static_cast<unsigned int>(std::stoul(s)); };
+                    obj.client_id = conv(value_str);
+                }
+            }
             if (std::getline(iss, token, ',')) {
                 auto pos = token.find('=');
                 if (pos != std::string::npos) {
@@ -1383,6 +1625,22 @@ public:
                     obj.mouse_pos_update_number = conv(value_str);
                 }
             }
+            if (std::getline(iss, token, ',')) {
+                auto pos = token.find('=');
+                if (pos != std::string::npos) {
+                    std::string value_str = token.substr(pos + 1);
+                    auto conv = [](const std::string &s) { return s == "true"; };
+                    obj.has_received_game_update = conv(value_str);
+                }
+            }
+            if (std::getline(iss, token, ',')) {
+                auto pos = token.find('=');
+                if (pos != std::string::npos) {
+                    std::string value_str = token.substr(pos + 1);
+                    auto conv = [](const std::string &s) { return static_cast<unsigned int>(std::stoul(s)); };
+                    obj.last_received_game_update_number = conv(value_str);
+                }
+            }
             if (std::getline(iss, token, ',')) {
                 auto pos = token.find('=');
                 if (pos != std::string::npos) {
@@ -1407,6 +1665,14 @@ public:
                     obj.subtick_percentage_when_fire_pressed = conv(value_str);
                 }
             }
+            if (std::getline(iss, token, ',')) {
+                auto pos = token.find('=');
+                if (pos != std::string::npos) {
+                    std::string value_str = token.substr(pos + 1);
+                    auto conv = [](const std::string &s) { return std::stod(s); };
+                    obj.entity_extrapolation_when_fire_pressed = conv(value_str);
+                }
+            }
             if (std::getline(iss, token, ',')) {
                 auto pos = token.find('=');
                 if (pos != std::string::npos) {
@@ -1484,9 +1750,18 @@ public:
               buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
             { auto ser = [=](const MouseUpdate& obj) -> std::vector<uint8_t> {
             std::vector<uint8_t> buffer;
+            { auto ser = [](const unsigned int &v) {   std::vector<uint8_t> buf(sizeof(unsigned int));   std::memcpy(buf.data(), &v, sizeof(unsigned int));   return buf; };
+              auto bytes = ser(obj.client_id);
+              buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
             { auto ser = [](const unsigned int &v) {   std::vector<uint8_t> buf(sizeof(unsigned int));   std::memcpy(buf.data(), &v, sizeof(unsigned int));   return buf; };
               auto bytes = ser(obj.mouse_pos_update_number);
               buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
+            { auto ser = [](const bool &v) {   std::vector<uint8_t> buf(1);   buf[0] = v ? 1 : 0;   return buf; };
+              auto bytes = ser(obj.has_received_game_update);
+              buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
+            { auto ser = [](const unsigned int &v) {   std::vector<uint8_t> buf(sizeof(unsigned int));   std::memcpy(buf.data(), &v, sizeof(unsigned int));   return buf; };
+              auto bytes = ser(obj.last_received_game_update_number);
+              buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
             { auto ser = [](const unsigned int &v) {   std::vector<uint8_t> buf(sizeof(unsigned int));   std::memcpy(buf.data(), &v, sizeof(unsigned int));   return buf; };
               auto bytes = ser(obj.last_applied_game_update_number_before_firing_entity_interpolation);
               buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
@@ -1496,6 +1771,9 @@ public:
             { auto ser = [](const double &v) {   std::vector<uint8_t> buf(sizeof(double));   std::memcpy(buf.data(), &v, sizeof(double));   return buf; };
               auto bytes = ser(obj.subtick_percentage_when_fire_pressed);
               buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
+            { auto ser = [](const double &v) {   std::vector<uint8_t> buf(sizeof(double));   std::memcpy(buf.data(), &v, sizeof(double));   return buf; };
+              auto bytes = ser(obj.entity_extrapolation_when_fire_pressed);
+              buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
             { auto ser = [](const double &v) {   std::vector<uint8_t> buf(sizeof(double));   std::memcpy(buf.data(), &v, sizeof(double));   return buf; };
               auto bytes = ser(obj.subtick_x_pos_before_firing);
               buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
@@ -1536,14 +1814,22 @@ public:
               total += size_fn(obj.header); }
             { auto size_fn = [=](const MouseUpdate& obj) -> size_t {
             size_t total = 0;
+            { auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
+              total += size_fn(obj.client_id); }
             { auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
               total += size_fn(obj.mouse_pos_update_number); }
+            { auto size_fn = [](const bool &v) { return sizeof(uint8_t); };
+              total += size_fn(obj.has_received_game_update); }
+            { auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
+              total += size_fn(obj.last_received_game_update_number); }
             { auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
               total += size_fn(obj.last_applied_game_update_number_before_firing_entity_interpolation); }
             { auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
               total += size_fn(obj.last_applied_game_update_number_before_firing_camera_cpsr); }
             { auto size_fn = [](const double &v) { return sizeof(double); };
               total += size_fn(obj.subtick_percentage_when_fire_pressed); }
+            { auto size_fn = [](const double &v) { return sizeof(double); };
+              total += size_fn(obj.entity_extrapolation_when_fire_pressed); }
             { auto size_fn = [](const double &v) { return sizeof(double); };
               total += size_fn(obj.subtick_x_pos_before_firing); }
             { auto size_fn = [](const double &v) { return sizeof(double); };
@@ -1612,6 +1898,14 @@ public:
             { auto deser = [=](const std::vector<uint8_t> &buffer) -> MouseUpdate {
             MouseUpdate obj;
             size_t offset = 0;
+            { auto deser = [](const std::vector<uint8_t> &buf) {   unsigned int v;   std::memcpy(&v, buf.data(), sizeof(unsigned int));   return v; };
+              auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
+              size_t len = size_fn(obj.client_id);
+              if (offset + len > buffer.size()) return obj;
+              std::vector<uint8_t> slice(buffer.begin() + offset, buffer.begin() + offset + len);
+              obj.client_id = deser(slice);
+              offset += len;
+            }
             { auto deser = [](const std::vector<uint8_t> &buf) {   unsigned int v;   std::memcpy(&v, buf.data(), sizeof(unsigned int));   return v; };
               auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
               size_t len = size_fn(obj.mouse_pos_update_number);
@@ -1620,6 +1914,22 @@ public:
               obj.mouse_pos_update_number = deser(slice);
               offset += len;
             }
+            { auto deser = [](const std::vector<uint8_t> &buf) {   return buf[0] != 0; };
+              auto size_fn = [](const bool &v) { return sizeof(uint8_t); };
+              size_t len = size_fn(obj.has_received_game_update);
+              if (offset + len > buffer.size()) return obj;
+              std::vector<uint8_t> slice(buffer.begin() + offset, buffer.begin() + offset + len);
+              obj.has_received_game_update = deser(slice);
+              offset += len;
+            }
+            { auto deser = [](const std::vector<uint8_t> &buf) {   unsigned int v;   std::memcpy(&v, buf.data(), sizeof(unsigned int));   return v; };
+              auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
+              size_t len = size_fn(obj.last_received_game_update_number);
+              if (offset + len > buffer.size()) return obj;
+              std::vector<uint8_t> slice(buffer.begin() + offset, buffer.begin() + offset + len);
+              obj.last_received_game_update_number = deser(slice);
+              offset += len;
+            }
             { auto deser = [](const std::vector<uint8_t> &buf) {   unsigned int v;   std::memcpy(&v, buf.data(), sizeof(unsigned int));   return v; };
               auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
               size_t len = size_fn(obj.last_applied_game_update_number_before_firing_entity_interpolation);
@@ -1644,6 +1954,14 @@ public:
               obj.subtick_percentage_when_fire_pressed = deser(slice);
               offset += len;
             }
+            { auto deser = [](const std::vector<uint8_t> &buf) {   double v;   std::memcpy(&v, buf.data(), sizeof(double));   return v; };
+              auto size_fn = [](const double &v) { return sizeof(double); };
+              size_t len = size_fn(obj.entity_extrapolation_when_fire_pressed);
+              if (offset + len > buffer.size()) return obj;
+              std::vector<uint8_t> slice(buffer.begin() + offset, buffer.begin() + offset + len);
+              obj.entity_extrapolation_when_fire_pressed = deser(slice);
+              offset += len;
+            }
             { auto deser = [](const std::vector<uint8_t> &buf) {   double v;   std::memcpy(&v, buf.data(), sizeof(double));   return v; };
               auto size_fn = [](const double &v) { return sizeof(double); };
               size_t len = size_fn(obj.subtick_x_pos_before_firing);
@@ -1696,14 +2014,22 @@ public:
         };
               auto size_fn = [=](const MouseUpdate& obj) -> size_t {
             size_t total = 0;
+            { auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
+              total += size_fn(obj.client_id); }
             { auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
               total += size_fn(obj.mouse_pos_update_number); }
+            { auto size_fn = [](const bool &v) { return sizeof(uint8_t); };
+              total += size_fn(obj.has_received_game_update); }
+            { auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
+              total += size_fn(obj.last_received_game_update_number); }
             { auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
               total += size_fn(obj.last_applied_game_update_number_before_firing_entity_interpolation); }
             { auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
               total += size_fn(obj.last_applied_game_update_number_before_firing_camera_cpsr); }
             { auto size_fn = [](const double &v) { return sizeof(double); };
               total += size_fn(obj.subtick_percentage_when_fire_pressed); }
+            { auto size_fn = [](const double &v) { return sizeof(double); };
+              total += size_fn(obj.entity_extrapolation_when_fire_pressed); }
             { auto size_fn = [](const double &v) { return sizeof(double); };
               total += size_fn(obj.subtick_x_pos_before_firing); }
             { auto size_fn = [](const double &v) { return sizeof(double); };
@@ -1738,6 +2064,11 @@ public:
                 case PacketType::MOUSE_UPDATE: return "PacketType::MOUSE_UPDATE";
                 case PacketType::GAME_UPDATE: return "PacketType::GAME_UPDATE";
                 case PacketType::SOUND_UPDATE: return "PacketType::SOUND_UPDATE";
+                case PacketType::GAME_UPDATE_QUANTIZED: return "PacketType::GAME_UPDATE_QUANTIZED";
+                case PacketType::MOUSE_UPDATE_QUANTIZED: return "PacketType::MOUSE_UPDATE_QUANTIZED";
+                case PacketType::GAME_UPDATE_DELTA: return "PacketType::GAME_UPDATE_DELTA";
+                case PacketType::GAME_FRAME: return "PacketType::GAME_FRAME";
+                case PacketType::MOUSE_UPDATE_WINDOW: return "PacketType::MOUSE_UPDATE_WINDOW";
                 default: return "<unknown PacketType>";
             }
         };
@@ -1753,6 +2084,9 @@ public:
             { auto conv = [=](const GameUpdate& obj) -> std::string {
             std::ostringstream oss;
             oss << "{";
+            { auto conv = [](const unsigned int &v) { return std::to_string(v); };
+              oss << "client_id=" << conv(obj.client_id); }
+            oss << ", ";
             { auto conv = [](const unsigned int &v) { return std::to_string(v); };
               oss << "last_processed_mouse_pos_update_number=" << conv(obj.last_processed_mouse_pos_update_number); }
             oss << ", ";
@@ -1773,6 +2107,15 @@ public:
             oss << ", ";
             { auto conv = [](const double &v) { return std::to_string(v); };
               oss << "target_z_pos=" << conv(obj.target_z_pos); }
+            oss << ", ";
+            { auto conv = [](const double &v) { return std::to_string(v); };
+              oss << "target_x_vel=" << conv(obj.target_x_vel); }
+            oss << ", ";
+            { auto conv = [](const double &v) { return std::to_string(v); };
+              oss << "target_y_vel=" << conv(obj.target_y_vel); }
+            oss << ", ";
+            { auto conv = [](const double &v) { return std::to_string(v); };
+              oss << "target_z_vel=" << conv(obj.target_z_vel); }
             oss << "}";
             return oss.str();
         };
@@ -1803,6 +2146,11 @@ public:
             if (s == "PacketType::MOUSE_UPDATE") return PacketType::MOUSE_UPDATE;
             if (s == "PacketType::GAME_UPDATE") return PacketType::GAME_UPDATE;
             if (s == "PacketType::SOUND_UPDATE") return PacketType::SOUND_UPDATE;
+            if (s == "PacketType::GAME_UPDATE_QUANTIZED") return PacketType::GAME_UPDATE_QUANTIZED;
+            if (s == "PacketType::MOUSE_UPDATE_QUANTIZED") return PacketType::MOUSE_UPDATE_QUANTIZED;
+            if (s == "PacketType::GAME_UPDATE_DELTA") return PacketType::GAME_UPDATE_DELTA;
+            if (s == "PacketType::GAME_FRAME") return PacketType::GAME_FRAME;
+            if (s == "PacketType::MOUSE_UPDATE_WINDOW") return PacketType::MOUSE_UPDATE_WINDOW;
             return static_cast<PacketType>(0); // default fallback
         };
                     obj.type = conv(value_str);
@@ -1830,6 +2178,14 @@ public:
             std::string trimmed = s.substr(1, s.size() - 2); // remove {}
             std::istringstream iss(trimmed);
             std::string token;
+            if (std::getline(iss, token, ',')) {
+                auto pos = token.find('=');
+                if (pos != std::string::npos) {
+                    std::string value_str = token.substr(pos + 1);
+                    auto conv = [](const std::string &s) { return static_cast<unsigned int>(std::stoul(s)); };
+                    obj.client_id = conv(value_str);
+                }
+            }
             if (std::getline(iss, token, ',')) {
                 auto pos = token.find('=');
                 if (pos != std::string::npos) {
@@ -1886,6 +2242,30 @@ public:
                     obj.target_z_pos = conv(value_str);
                 }
             }
+            if (std::getline(iss, token, ',')) {
+                auto pos = token.find('=');
+                if (pos != std::string::npos) {
+                    std::string value_str = token.substr(pos + 1);
+                    auto conv = [](const std::string &s) { return std::stod(s); };
+                    obj.target_x_vel = conv(value_str);
+                }
+            }
+            if (std::getline(iss, token, ',')) {
+                auto pos = token.find('=');
+                if (pos != std::string::npos) {
+                    std::string value_str = token.substr(pos + 1);
+                    auto conv = [](const std::string &s) { return std::stod(s); };
+                    obj.target_y_vel = conv(value_str);
+                }
+            }
+            if (std::getline(iss, token, ',')) {
+                auto pos = token.find('=');
+                if (pos != std::string::npos) {
+                    std::string value_str = token.substr(pos + 1);
+                    auto conv = [](const std::string &s) { return std::stod(s); };
+                    obj.target_z_vel = conv(value_str);
+                }
+            }
             return obj;
         };
                     obj.game_update = conv(value_str);
@@ -1915,6 +2295,9 @@ public:
               buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
             { auto ser = [=](const GameUpdate& obj) -> std::vector<uint8_t> {
             std::vector<uint8_t> buffer;
+            { auto ser = [](const unsigned int &v) {   std::vector<uint8_t> buf(sizeof(unsigned int));   std::memcpy(buf.data(), &v, sizeof(unsigned int));   return buf; };
+              auto bytes = ser(obj.client_id);
+              buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
             { auto ser = [](const unsigned int &v) {   std::vector<uint8_t> buf(sizeof(unsigned int));   std::memcpy(buf.data(), &v, sizeof(unsigned int));   return buf; };
               auto bytes = ser(obj.last_processed_mouse_pos_update_number);
               buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
@@ -1936,6 +2319,15 @@ public:
             { auto ser = [](const double &v) {   std::vector<uint8_t> buf(sizeof(double));   std::memcpy(buf.data(), &v, sizeof(double));   return buf; };
               auto bytes = ser(obj.target_z_pos);
               buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
+            { auto ser = [](const double &v) {   std::vector<uint8_t> buf(sizeof(double));   std::memcpy(buf.data(), &v, sizeof(double));   return buf; };
+              auto bytes = ser(obj.target_x_vel);
+              buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
+            { auto ser = [](const double &v) {   std::vector<uint8_t> buf(sizeof(double));   std::memcpy(buf.data(), &v, sizeof(double));   return buf; };
+              auto bytes = ser(obj.target_y_vel);
+              buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
+            { auto ser = [](const double &v) {   std::vector<uint8_t> buf(sizeof(double));   std::memcpy(buf.data(), &v, sizeof(double));   return buf; };
+              auto bytes = ser(obj.target_z_vel);
+              buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
             return buffer;
         };
               auto bytes = ser(obj.game_update);
@@ -1958,6 +2350,8 @@ public:
               total += size_fn(obj.header); }
             { auto size_fn = [=](const GameUpdate& obj) -> size_t {
             size_t total = 0;
+            { auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
+              total += size_fn(obj.client_id); }
             { auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
               total += size_fn(obj.last_processed_mouse_pos_update_number); }
             { auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
@@ -1972,6 +2366,12 @@ public:
               total += size_fn(obj.target_y_pos); }
             { auto size_fn = [](const double &v) { return sizeof(double); };
               total += size_fn(obj.target_z_pos); }
+            { auto size_fn = [](const double &v) { return sizeof(double); };
+              total += size_fn(obj.target_x_vel); }
+            { auto size_fn = [](const double &v) { return sizeof(double); };
+              total += size_fn(obj.target_y_vel); }
+            { auto size_fn = [](const double &v) { return sizeof(double); };
+              total += size_fn(obj.target_z_vel); }
             return total;
         };
               total += size_fn(obj.game_update); }
@@ -2028,6 +2428,14 @@ public:
             { auto deser = [=](const std::vector<uint8_t> &buffer) -> GameUpdate {
             GameUpdate obj;
             size_t offset = 0;
+            { auto deser = [](const std::vector<uint8_t> &buf) {   unsigned int v;   std::memcpy(&v, buf.data(), sizeof(unsigned int));   return v; };
+              auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
+              size_t len = size_fn(obj.client_id);
+              if (offset + len > buffer.size()) return obj;
+              std::vector<uint8_t> slice(buffer.begin() + offset, buffer.begin() + offset + len);
+              obj.client_id = deser(slice);
+              offset += len;
+            }
             { auto deser = [](const std::vector<uint8_t> &buf) {   unsigned int v;   std::memcpy(&v, buf.data(), sizeof(unsigned int));   return v; };
               auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
               size_t len = size_fn(obj.last_processed_mouse_pos_update_number);
@@ -2084,10 +2492,36 @@ public:
               obj.target_z_pos = deser(slice);
               offset += len;
             }
+            { auto deser = [](const std::vector<uint8_t> &buf) {   double v;   std::memcpy(&v, buf.data(), sizeof(double));   return v; };
+              auto size_fn = [](const double &v) { return sizeof(double); };
+              size_t len = size_fn(obj.target_x_vel);
+              if (offset + len > buffer.size()) return obj;
+              std::vector<uint8_t> slice(buffer.begin() + offset, buffer.begin() + offset + len);
+              obj.target_x_vel = deser(slice);
+              offset += len;
+            }
+            { auto deser = [](const std::vector<uint8_t> &buf) {   double v;   std::memcpy(&v, buf.data(), sizeof(double));   return v; };
+              auto size_fn = [](const double &v) { return sizeof(double); };
+              size_t len = size_fn(obj.target_y_vel);
+              if (offset + len > buffer.size()) return obj;
+              std::vector<uint8_t> slice(buffer.begin() + offset, buffer.begin() + offset + len);
+              obj.target_y_vel = deser(slice);
+              offset += len;
+            }
+            { auto deser = [](const std::vector<uint8_t> &buf) {   double v;   std::memcpy(&v, buf.data(), sizeof(double));   return v; };
+              auto size_fn = [](const double &v) { return sizeof(double); };
+              size_t len = size_fn(obj.target_z_vel);
+              if (offset + len > buffer.size()) return obj;
+              std::vector<uint8_t> slice(buffer.begin() + offset, buffer.begin() + offset + len);
+              obj.target_z_vel = deser(slice);
+              offset += len;
+            }
             return obj;
         };
               auto size_fn = [=](const GameUpdate& obj) -> size_t {
             size_t total = 0;
+            { auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
+              total += size_fn(obj.client_id); }
             { auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
               total += size_fn(obj.last_processed_mouse_pos_update_number); }
             { auto size_fn = [](const unsigned int &v) { return sizeof(unsigned int); };
@@ -2102,6 +2536,12 @@ public:
               total += size_fn(obj.target_y_pos); }
             { auto size_fn = [](const double &v) { return sizeof(double); };
               total += size_fn(obj.target_z_pos); }
+            { auto size_fn = [](const double &v) { return sizeof(double); };
+              total += size_fn(obj.target_x_vel); }
+            { auto size_fn = [](const double &v) { return sizeof(double); };
+              total += size_fn(obj.target_y_vel); }
+            { auto size_fn = [](const double &v) { return sizeof(double); };
+              total += size_fn(obj.target_z_vel); }
             return total;
         };
               size_t len = size_fn(obj.game_update);
@@ -2124,6 +2564,11 @@ public:
                 case PacketType::MOUSE_UPDATE: return "PacketType::MOUSE_UPDATE";
                 case PacketType::GAME_UPDATE: return "PacketType::GAME_UPDATE";
                 case PacketType::SOUND_UPDATE: return "PacketType::SOUND_UPDATE";
+                case PacketType::GAME_UPDATE_QUANTIZED: return "PacketType::GAME_UPDATE_QUANTIZED";
+                case PacketType::MOUSE_UPDATE_QUANTIZED: return "PacketType::MOUSE_UPDATE_QUANTIZED";
+                case PacketType::GAME_UPDATE_DELTA: return "PacketType::GAME_UPDATE_DELTA";
+                case PacketType::GAME_FRAME: return "PacketType::GAME_FRAME";
+                case PacketType::MOUSE_UPDATE_WINDOW: return "PacketType::MOUSE_UPDATE_WINDOW";
                 default: return "<unknown PacketType>";
             }
         };
@@ -2191,6 +2636,11 @@ public:
             if (s == "PacketType::MOUSE_UPDATE") return PacketType::MOUSE_UPDATE;
             if (s == "PacketType::GAME_UPDATE") return PacketType::GAME_UPDATE;
             if (s == "PacketType::SOUND_UPDATE") return PacketType::SOUND_UPDATE;
+            if (s == "PacketType::GAME_UPDATE_QUANTIZED") return PacketType::GAME_UPDATE_QUANTIZED;
+            if (s == "PacketType::MOUSE_UPDATE_QUANTIZED") return PacketType::MOUSE_UPDATE_QUANTIZED;
+            if (s == "PacketType::GAME_UPDATE_DELTA") return PacketType::GAME_UPDATE_DELTA;
+            if (s == "PacketType::GAME_FRAME") return PacketType::GAME_FRAME;
+            if (s == "PacketType::MOUSE_UPDATE_WINDOW") return PacketType::MOUSE_UPDATE_WINDOW;
             return static_cast<PacketType>(0); // default fallback
         };
                     obj.type = conv(value_str);
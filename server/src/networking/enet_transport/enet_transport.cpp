@@ -0,0 +1,120 @@
+#include "enet_transport.hpp"
+
+#include "../../utility/logger/logger.hpp"
+
+EnetServerTransport::EnetServerTransport(uint16_t port,
+                                         size_t max_client_count)
+    : port(port), max_client_count(max_client_count) {}
+
+EnetServerTransport::~EnetServerTransport() {
+  if (host != nullptr) {
+    enet_host_destroy(host);
+  }
+  if (initialized_enet) {
+    enet_deinitialize();
+  }
+}
+
+bool EnetServerTransport::initialize_network() {
+  if (enet_initialize() != 0) {
+    global_logger.warn("couldn't initialize enet");
+    return false;
+  }
+  initialized_enet = true;
+
+  ENetAddress address;
+  address.host = ENET_HOST_ANY;
+  address.port = port;
+  // NOTE: no channel limit, so whatever number of channels a client asks for
+  // is accepted, everything is sent on channel 0
+  host = enet_host_create(&address, max_client_count, 0, 0, 0);
+  if (host == nullptr) {
+    global_logger.warn("couldn't create an enet host on port {}", port);
+    return false;
+  }
+  return true;
+}
+
+std::vector<PacketWithSize>
+EnetServerTransport::get_network_events_since_last_tick() {
+  std::vector<PacketWithSize> packets;
+  for (ReceivedPacket &received : get_received_packets_since_last_tick()) {
+    packets.push_back(std::move(received.packet));
+  }
+  return packets;
+}
+
+std::vector<ReceivedPacket>
+EnetServerTransport::get_received_packets_since_last_tick() {
+  std::vector<ReceivedPacket> packets;
+  if (host == nullptr) {
+    return packets;
+  }
+
+  auto now = std::chrono::steady_clock::now();
+  ENetEvent event;
+  while (enet_host_service(host, &event, 0) > 0) {
+    switch (event.type) {
+    case ENET_EVENT_TYPE_CONNECT: {
+      unsigned int client_id = next_client_id++;
+      client_id_to_peer[client_id] = event.peer;
+      peer_to_client_id[event.peer] = client_id;
+      global_logger.info("enet client {} connected", client_id);
+      break;
+    }
+    case ENET_EVENT_TYPE_DISCONNECT: {
+      auto known = peer_to_client_id.find(event.peer);
+      if (known != peer_to_client_id.end()) {
+        global_logger.info("enet client {} disconnected", known->second);
+        client_id_to_peer.erase(known->second);
+        peer_to_client_id.erase(known);
+      }
+      break;
+    }
+    case ENET_EVENT_TYPE_RECEIVE: {
+      // NOTE: a peer only gets here after its connect event, this is just in
+      // case
+      auto known = peer_to_client_id.find(event.peer);
+      if (known != peer_to_client_id.end()) {
+        ReceivedPacket received;
+        received.packet.data.assign(event.packet->data,
+                                    event.packet->data +
+                                        event.packet->dataLength);
+        received.packet.size = event.packet->dataLength;
+        received.received_at = now;
+        received.sender_client_id = known->second;
+        packets.push_back(std::move(received));
+      }
+      enet_packet_destroy(event.packet);
+      break;
+    }
+    case ENET_EVENT_TYPE_NONE:
+      break;
+    }
+  }
+  return packets;
+}
+
+void EnetServerTransport::unreliable_send(unsigned int client_id,
+                                          const void *data, size_t size) {
+  auto peer = client_id_to_peer.find(client_id);
+  if (peer == client_id_to_peer.end()) {
+    return;
+  }
+  enet_peer_send(peer->second, 0, enet_packet_create(data, size, 0));
+}
+
+std::vector<unsigned int> EnetServerTransport::get_connected_client_ids() {
+  std::vector<unsigned int> client_ids;
+  client_ids.reserve(client_id_to_peer.size());
+  for (const auto &[client_id, peer] : client_id_to_peer) {
+    client_ids.push_back(client_id);
+  }
+  return client_ids;
+}
+
+void EnetServerTransport::flush() {
+  if (host != nullptr) {
+    enet_host_flush(host);
+  }
+}
@@ -0,0 +1,50 @@
+#ifndef ENET_TRANSPORT_HPP
+#define ENET_TRANSPORT_HPP
+
+// NOTE: the server's enet backend, it speaks the same protocol as the enet
+// backed Network in server_networking so the clients' Network connects to it
+// unchanged, but it runs enet itself so that every packet can be attributed
+// to the peer it arrived from, see ReceivedPacket. A client is an enet peer,
+// it gets a client id when it connects and loses it when it disconnects or
+// times out.
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include <enet/enet.h>
+
+#include "../transport/transport.hpp"
+
+class EnetServerTransport : public ServerTransport {
+public:
+  explicit EnetServerTransport(uint16_t port, size_t max_client_count = 1024);
+  ~EnetServerTransport() override;
+
+  EnetServerTransport(const EnetServerTransport &) = delete;
+  EnetServerTransport &operator=(const EnetServerTransport &) = delete;
+
+  // NOTE: returns false if enet or the host couldn't be set up, the reason is
+  // logged
+  bool initialize_network();
+
+  std::vector<PacketWithSize> get_network_events_since_last_tick() override;
+  // NOTE: the sender is the client the peer the packet came in on belongs to
+  std::vector<ReceivedPacket> get_received_packets_since_last_tick() override;
+  void unreliable_send(unsigned int client_id, const void *data,
+                       size_t size) override;
+  std::vector<unsigned int> get_connected_client_ids() override;
+  void flush() override;
+
+private:
+  uint16_t port;
+  size_t max_client_count;
+  bool initialized_enet = false;
+  ENetHost *host = nullptr;
+
+  unsigned int next_client_id = 0;
+  std::map<unsigned int, ENetPeer *> client_id_to_peer;
+  std::map<ENetPeer *, unsigned int> peer_to_client_id;
+};
+
+#endif // ENET_TRANSPORT_HPP
@@ -0,0 +1,96 @@
+#include "loopback_transport.hpp"
+
+#include <cstring>
+
+std::vector<PacketWithSize>
+LoopbackServerTransport::get_network_events_since_last_tick() {
+  std::vector<PacketWithSize> packets;
+  for (ReceivedPacket &received : get_received_packets_since_last_tick()) {
+    packets.push_back(std::move(received.packet));
+  }
+  return packets;
+}
+
+std::vector<ReceivedPacket>
+LoopbackServerTransport::get_received_packets_since_last_tick() {
+  return hub.take_delivered(hub.packets_to_server);
+}
+
+void LoopbackServerTransport::unreliable_send(unsigned int client_id,
+                                              const void *data, size_t size) {
+  auto queue = hub.packets_to_client.find(client_id);
+  if (queue == hub.packets_to_client.end()) {
+    // NOTE: like enet, sending to a client that left goes nowhere
+    return;
+  }
+  hub.enqueue(queue->second, 0, data, size);
+}
+
+std::vector<unsigned int> LoopbackServerTransport::get_connected_client_ids() {
+  std::vector<unsigned int> client_ids;
+  client_ids.reserve(hub.clients.size());
+  for (const auto &[client_id, client] : hub.clients) {
+    client_ids.push_back(client_id);
+  }
+  return client_ids;
+}
+
+std::vector<PacketWithSize>
+LoopbackClientTransport::get_network_events_received_since_last_tick() {
+  std::vector<PacketWithSize> packets;
+  for (ReceivedPacket &received :
+       hub.take_delivered(hub.packets_to_client[client_id])) {
+    packets.push_back(std::move(received.packet));
+  }
+  return packets;
+}
+
+void LoopbackClientTransport::send_packet(const void *data, size_t size) {
+  hub.enqueue(hub.packets_to_server, client_id, data, size);
+}
+
+LoopbackHub::LoopbackHub(double one_way_latency)
+    : one_way_latency(one_way_latency), server_transport(*this) {}
+
+LoopbackClientTransport &LoopbackHub::connect_client() {
+  unsigned int client_id = next_client_id++;
+  packets_to_client[client_id];
+  auto client = std::make_unique<LoopbackClientTransport>(*this, client_id);
+  LoopbackClientTransport &client_ref = *client;
+  clients.emplace(client_id, std::move(client));
+  return client_ref;
+}
+
+void LoopbackHub::disconnect_client(unsigned int client_id) {
+  clients.erase(client_id);
+  packets_to_client.erase(client_id);
+}
+
+void LoopbackHub::enqueue(std::deque<InFlightPacket> &queue,
+                          unsigned int sender_client_id, const void *data,
+                          size_t size) {
+  InFlightPacket packet;
+  packet.delivery_time = time + one_way_latency;
+  packet.sender_client_id = sender_client_id;
+  packet.data.resize(size);
+  std::memcpy(packet.data.data(), data, size);
+  queue.push_back(std::move(packet));
+}
+
+// NOTE: stamped with the real time they were taken, the virtual clock doesn't
+// mean anything to the packet wait statistics
+std::vector<ReceivedPacket>
+LoopbackHub::take_delivered(std::deque<InFlightPacket> &queue) {
+  auto now = std::chrono::steady_clock::now();
+  std::vector<ReceivedPacket> delivered;
+  while (not queue.empty() and queue.front().delivery_time <= time) {
+    ReceivedPacket received;
+    received.packet.size = queue.front().data.size();
+    received.packet.data = std::move(queue.front().data);
+    received.received_at = now;
+    received.sender_client_id = queue.front().sender_client_id;
+    delivered.push_back(std::move(received));
+    queue.pop_front();
+  }
+  return delivered;
+}
@@ -0,0 +1,98 @@
+#ifndef LOOPBACK_TRANSPORT_HPP
+#define LOOPBACK_TRANSPORT_HPP
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "../transport/transport.hpp"
+
+class LoopbackHub;
+
+class LoopbackServerTransport : public ServerTransport {
+public:
+  explicit LoopbackServerTransport(LoopbackHub &hub) : hub(hub) {}
+
+  std::vector<PacketWithSize> get_network_events_since_last_tick() override;
+  std::vector<ReceivedPacket> get_received_packets_since_last_tick() override;
+  void unreliable_send(unsigned int client_id, const void *data,
+                       size_t size) override;
+  std::vector<unsigned int> get_connected_client_ids() override;
+
+private:
+  LoopbackHub &hub;
+};
+
+class LoopbackClientTransport : public ClientTransport {
+public:
+  LoopbackClientTransport(LoopbackHub &hub, unsigned int client_id)
+      : hub(hub), client_id(client_id) {}
+
+  std::vector<PacketWithSize>
+  get_network_events_received_since_last_tick() override;
+  void send_packet(const void *data, size_t size) override;
+
+  unsigned int get_client_id() const { return client_id; }
+
+private:
+  LoopbackHub &hub;
+  unsigned int client_id;
+};
+
+// NOTE: connects one server transport to any number of client transports in
+// memory so that the server and its clients can run in a single process,
+// packets arrive after a fixed one way latency measured on a virtual clock
+// which only moves when advance_time is called, this makes a run depend only on
+// its inputs and not on how busy the machine or the network is, which is what
+// you want when comparing two versions of the server. Nothing is ever dropped
+// or reordered. Not thread safe, everything is driven from one thread.
+class LoopbackHub {
+public:
+  explicit LoopbackHub(double one_way_latency = 0);
+
+  LoopbackHub(const LoopbackHub &) = delete;
+  LoopbackHub &operator=(const LoopbackHub &) = delete;
+
+  ServerTransport &get_server_transport() { return server_transport; }
+
+  // NOTE: the server sees the client as connected from now on, the returned
+  // transport is destroyed by disconnect_client or with the hub
+  LoopbackClientTransport &connect_client();
+  void disconnect_client(unsigned int client_id);
+
+  // NOTE: packets whose delivery time has been reached become visible to the
+  // next get_network_events call of their receiver
+  void advance_time(double dt) { time += dt; }
+  double get_time() const { return time; }
+
+private:
+  friend class LoopbackServerTransport;
+  friend class LoopbackClientTransport;
+
+  // NOTE: the sender is only used for packets going to the server
+  struct InFlightPacket {
+    double delivery_time;
+    unsigned int sender_client_id;
+    std::vector<char> data;
+  };
+
+  // NOTE: the latency is fixed so each queue is already in delivery order
+  void enqueue(std::deque<InFlightPacket> &queue, unsigned int sender_client_id,
+               const void *data, size_t size);
+  std::vector<ReceivedPacket> take_delivered(std::deque<InFlightPacket> &queue);
+
+  double one_way_latency;
+  double time = 0;
+
+  LoopbackServerTransport server_transport;
+  std::deque<InFlightPacket> packets_to_server;
+
+  unsigned int next_client_id = 0;
+  // NOTE: pointers so that transports handed out stay put as clients come and
+  // go
+  std::map<unsigned int, std::unique_ptr<LoopbackClientTransport>> clients;
+  std::map<unsigned int, std::deque<InFlightPacket>> packets_to_client;
+};
+
+#endif // LOOPBACK_TRANSPORT_HPP
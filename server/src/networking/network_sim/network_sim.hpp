@@ -0,0 +1,170 @@
+#ifndef NETWORK_SIM_HPP
+#define NETWORK_SIM_HPP
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../../utility/config_file_parser/config_file_parser.hpp"
+#include "../transport/transport.hpp"
+
+enum class JitterDistribution {
+  // NOTE: anywhere in [-jitter, jitter]
+  UNIFORM,
+  // NOTE: a normal distribution with jitter as its standard deviation
+  NORMAL,
+  // NOTE: only ever adds delay, with a long tail, mean jitter, this is closest
+  // to what queueing on a busy link does
+  EXPONENTIAL,
+};
+
+// NOTE: returns NORMAL for anything it doesn't recognize
+JitterDistribution jitter_distribution_from_string(const std::string &name);
+
+// NOTE: what happens to packets going one way, times are in seconds and rates
+// are probabilities per packet
+struct LinkImpairment {
+  double latency = 0;
+  double jitter = 0;
+  JitterDistribution jitter_distribution = JitterDistribution::NORMAL;
+  double drop_rate = 0;
+  double duplicate_rate = 0;
+  // NOTE: a reordered packet is held back an extra reorder_delay so that the
+  // ones sent after it overtake it, the others are kept in order even if
+  // jitter would have swapped them, like most real links do, which means the
+  // mean delay ends up a little above latency when packets are close together
+  double reorder_rate = 0;
+  double reorder_delay = 0.02;
+};
+
+// NOTE: up is client to server and down is server to client, whichever end the
+// simulator is enabled on applies both directions, so it should only be
+// enabled on one end of a connection.
+struct NetworkSimSettings {
+  bool enabled = false;
+  LinkImpairment up;
+  LinkImpairment down;
+  unsigned int seed = 0;
+};
+
+// NOTE: reads the [network_sim] section, keys are enabled, seed,
+// jitter_distribution and for each of up_ and down_: latency_ms, jitter_ms,
+// drop_rate, duplicate_rate, reorder_rate, reorder_delay_ms
+NetworkSimSettings network_sim_settings_from_configuration(
+    Configuration &configuration);
+
+// NOTE: seconds since some fixed point, steady_clock unless the transport runs
+// on a virtual clock, see LoopbackHub::get_time
+using SimulationClock = std::function<double()>;
+SimulationClock real_time_clock();
+
+// NOTE: holds packets going one way until their delivery time, the client id
+// is the client a packet is going to or came from, it is only used by the
+// server, where sends are addressed to a client and the wrapped transport may
+// say who sent what.
+class ImpairedLink {
+public:
+  ImpairedLink(const LinkImpairment &impairment, unsigned int seed);
+
+  // NOTE: may drop the packet or schedule it more than once
+  void push(std::optional<unsigned int> client_id, const void *data,
+            size_t size, double now);
+
+  struct DeliveredPacket {
+    std::optional<unsigned int> client_id;
+    PacketWithSize packet;
+  };
+  std::vector<DeliveredPacket> pop_delivered(double now);
+
+  uint64_t get_dropped_count() const { return dropped_count; }
+  uint64_t get_duplicated_count() const { return duplicated_count; }
+  uint64_t get_reordered_count() const { return reordered_count; }
+
+private:
+  double sample_delay();
+  void schedule(std::optional<unsigned int> client_id, const void *data,
+                size_t size, double now);
+
+  struct InFlightPacket {
+    double delivery_time;
+    // NOTE: breaks ties so equal delivery times come out in send order
+    uint64_t sequence;
+    std::optional<unsigned int> client_id;
+    std::vector<char> data;
+  };
+  struct DeliversLater {
+    bool operator()(const InFlightPacket &a, const InFlightPacket &b) const {
+      if (a.delivery_time != b.delivery_time) {
+        return a.delivery_time > b.delivery_time;
+      }
+      return a.sequence > b.sequence;
+    }
+  };
+
+  LinkImpairment impairment;
+  std::mt19937 random_engine;
+  std::priority_queue<InFlightPacket, std::vector<InFlightPacket>,
+                      DeliversLater>
+      in_flight;
+  uint64_t next_sequence = 0;
+  double last_in_order_delivery_time = 0;
+
+  uint64_t dropped_count = 0;
+  uint64_t duplicated_count = 0;
+  uint64_t reordered_count = 0;
+};
+
+// NOTE: decorators that impair whatever transport they wrap, be it the enet
+// backed one or a loopback, the wrapped transport has to outlive them. Delayed
+// sends are handed to the wrapped transport the next time either function of
+// the decorator is called, on the server and the clients that is at least once
+// a tick, so delays are rounded up to the caller's tick.
+class SimulatedServerTransport : public ServerTransport {
+public:
+  SimulatedServerTransport(ServerTransport &transport,
+                           const NetworkSimSettings &settings,
+                           SimulationClock clock = real_time_clock());
+
+  std::vector<PacketWithSize> get_network_events_since_last_tick() override;
+  // NOTE: the senders are the ones the wrapped transport reported
+  std::vector<ReceivedPacket> get_received_packets_since_last_tick() override;
+  void unreliable_send(unsigned int client_id, const void *data,
+                       size_t size) override;
+  std::vector<unsigned int> get_connected_client_ids() override {
+    return transport.get_connected_client_ids();
+  }
+  void flush() override;
+
+private:
+  void send_delivered(double now);
+
+  ServerTransport &transport;
+  SimulationClock clock;
+  ImpairedLink incoming;
+  ImpairedLink outgoing;
+};
+
+class SimulatedClientTransport : public ClientTransport {
+public:
+  SimulatedClientTransport(ClientTransport &transport,
+                           const NetworkSimSettings &settings,
+                           SimulationClock clock = real_time_clock());
+
+  std::vector<PacketWithSize>
+  get_network_events_received_since_last_tick() override;
+  void send_packet(const void *data, size_t size) override;
+
+private:
+  void send_delivered(double now);
+
+  ClientTransport &transport;
+  SimulationClock clock;
+  ImpairedLink incoming;
+  ImpairedLink outgoing;
+};
+
+#endif // NETWORK_SIM_HPP
@@ -6,8 +6,24 @@
 
 #include <iostream>
 
+// NOTE: MouseUpdate and GameUpdate can also be sent bit packed as
+// MOUSE_UPDATE_QUANTIZED and GAME_UPDATE_QUANTIZED, the range and bit count
+// used for each field along with the precision that loses is in wire_format,
+// GameUpdate can additionally be delta compressed as GAME_UPDATE_DELTA.
+// NOTE: the server stamps each client's id into the game updates it sends that
+// client and the client echoes it back in its mouse updates, a client has no
+// id until its first game update arrives and doesn't send mouse updates before
+// then. The server only goes by the echoed id when its transport can't tell
+// who sent a packet (the enet backed one), otherwise anyone could send inputs
+// in another client's name, see ReceivedPacket.
 struct MouseUpdate {
+  unsigned int client_id;
   unsigned int mouse_pos_update_number;
+  // NOTE: acknowledges the newest game update the client has received, the
+  // server uses it as the baseline for GAME_UPDATE_DELTA, there is nothing to
+  // acknowledge until the first game update arrives hence the flag
+  bool has_received_game_update;
+  unsigned int last_received_game_update_number;
   // subtick specific stuff
 
   // NOTE: the two game updates below are not always synchronized, when entity
@@ -22,6 +38,11 @@ struct MouseUpdate {
   unsigned int last_applied_game_update_number_before_firing_camera_cpsr;
 
   double subtick_percentage_when_fire_pressed;
+  // NOTE: when the client had run out of game updates to interpolate between
+  // it dead reckoned the target this many seconds past the entity
+  // interpolation game update above, zero when it didn't, the server
+  // extrapolates the same way so it rewinds to the target the client drew
+  double entity_extrapolation_when_fire_pressed;
   // NOTE: these are required because yaw pitch has to be adjusted as well as
   // target position during server revert
   double subtick_x_pos_before_firing;
@@ -34,6 +55,7 @@ struct MouseUpdate {
 };
 
 struct GameUpdate {
+  unsigned int client_id;
   unsigned int last_processed_mouse_pos_update_number;
   unsigned int update_number;
   double yaw;
@@ -41,6 +63,11 @@ struct GameUpdate {
   double target_x_pos;
   double target_y_pos;
   double target_z_pos;
+  // NOTE: lets the client interpolate along the target's path rather than in
+  // a straight line between updates, and extrapolate when updates run late
+  double target_x_vel;
+  double target_y_vel;
+  double target_z_vel;
 };
 
 struct SoundUpdate {
@@ -0,0 +1,109 @@
+#include "threaded_transport.hpp"
+
+ThreadedServerTransport::ThreadedServerTransport(
+    ServerTransport &transport, size_t queue_capacity,
+    std::chrono::microseconds idle_poll_interval)
+    : transport(transport), idle_poll_interval(idle_poll_interval),
+      incoming(queue_capacity), outgoing(queue_capacity),
+      connected_client_ids(transport.get_connected_client_ids()),
+      io_thread(&ThreadedServerTransport::run, this) {}
+
+ThreadedServerTransport::~ThreadedServerTransport() {
+  running = false;
+  io_thread.join();
+}
+
+void ThreadedServerTransport::run() {
+  while (running.load(std::memory_order_relaxed)) {
+    bool did_something = send_queued_packets();
+    did_something = receive_packets() or did_something;
+
+    std::vector<unsigned int> client_ids = transport.get_connected_client_ids();
+    {
+      std::lock_guard<std::mutex> lock(connected_client_ids_mutex);
+      connected_client_ids = std::move(client_ids);
+    }
+
+    // NOTE: only back off when there was nothing to do, so a burst is drained
+    // as fast as it comes in
+    if (not did_something) {
+      std::this_thread::sleep_for(idle_poll_interval);
+    }
+  }
+  // NOTE: whatever the tick queued up last still goes out
+  send_queued_packets();
+  transport.flush();
+}
+
+bool ThreadedServerTransport::send_queued_packets() {
+  bool did_anything = false;
+  OutgoingPacket packet;
+  while (outgoing.try_pop(packet)) {
+    if (packet.is_flush) {
+      transport.flush();
+    } else {
+      transport.unreliable_send(packet.client_id, packet.data.data(),
+                                packet.data.size());
+    }
+    did_anything = true;
+  }
+  if (flush_requested.exchange(false, std::memory_order_acquire)) {
+    transport.flush();
+    did_anything = true;
+  }
+  return did_anything;
+}
+
+bool ThreadedServerTransport::receive_packets() {
+  std::vector<ReceivedPacket> received =
+      transport.get_received_packets_since_last_tick();
+  for (ReceivedPacket &packet : received) {
+    if (not incoming.try_push(std::move(packet))) {
+      dropped_incoming_count.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+  return not received.empty();
+}
+
+std::vector<ReceivedPacket>
+ThreadedServerTransport::get_received_packets_since_last_tick() {
+  std::vector<ReceivedPacket> received;
+  ReceivedPacket packet;
+  while (incoming.try_pop(packet)) {
+    received.push_back(std::move(packet));
+  }
+  return received;
+}
+
+std::vector<PacketWithSize>
+ThreadedServerTransport::get_network_events_since_last_tick() {
+  std::vector<PacketWithSize> packets;
+  for (ReceivedPacket &packet : get_received_packets_since_last_tick()) {
+    packets.push_back(std::move(packet.packet));
+  }
+  return packets;
+}
+
+void ThreadedServerTransport::unreliable_send(unsigned int client_id,
+                                              const void *data, size_t size) {
+  OutgoingPacket packet;
+  packet.client_id = client_id;
+  packet.data.assign(static_cast<const char *>(data),
+                     static_cast<const char *>(data) + size);
+  if (not outgoing.try_push(std::move(packet))) {
+    dropped_outgoing_count++;
+  }
+}
+
+void ThreadedServerTransport::flush() {
+  OutgoingPacket marker;
+  marker.is_flush = true;
+  if (not outgoing.try_push(std::move(marker))) {
+    flush_requested.store(true, std::memory_order_release);
+  }
+}
+
+std::vector<unsigned int> ThreadedServerTransport::get_connected_client_ids() {
+  std::lock_guard<std::mutex> lock(connected_client_ids_mutex);
+  return connected_client_ids;
+}
@@ -0,0 +1,87 @@
+#ifndef THREADED_TRANSPORT_HPP
+#define THREADED_TRANSPORT_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../../utility/spsc_queue/spsc_queue.hpp"
+#include "../transport/transport.hpp"
+
+// NOTE: moves all work on the wrapped transport onto a thread of its own, that
+// thread polls it continuously and stamps every packet the moment it comes
+// out, the tick then only has to drain a queue, so a burst of packets no
+// longer stretches the tick and the time a packet sat waiting for the tick
+// can be measured. Sends are queued the other way and made from the same
+// thread because the wrapped transport (enet) isn't thread safe. Must only be
+// used from one thread (the tick), the wrapped transport must outlive it and
+// must not be touched by anything else while it exists.
+class ThreadedServerTransport : public ServerTransport {
+public:
+  ThreadedServerTransport(
+      ServerTransport &transport, size_t queue_capacity = 4096,
+      std::chrono::microseconds idle_poll_interval =
+          std::chrono::microseconds(250));
+  ~ThreadedServerTransport() override;
+
+  ThreadedServerTransport(const ThreadedServerTransport &) = delete;
+  ThreadedServerTransport &
+  operator=(const ThreadedServerTransport &) = delete;
+
+  std::vector<PacketWithSize> get_network_events_since_last_tick() override;
+  std::vector<ReceivedPacket> get_received_packets_since_last_tick() override;
+  void unreliable_send(unsigned int client_id, const void *data,
+                       size_t size) override;
+  // NOTE: queued behind the tick's sends, the I/O thread only flushes the
+  // wrapped transport when it gets to it so that a tick's datagrams still go
+  // out together
+  void flush() override;
+  // NOTE: as of the I/O thread's last poll
+  std::vector<unsigned int> get_connected_client_ids() override;
+
+  // NOTE: packets thrown away because a queue was full, incoming when the tick
+  // falls behind, outgoing when the I/O thread does
+  uint64_t get_dropped_incoming_count() const {
+    return dropped_incoming_count.load(std::memory_order_relaxed);
+  }
+  uint64_t get_dropped_outgoing_count() const { return dropped_outgoing_count; }
+
+private:
+  // NOTE: either a packet to send or, when is_flush is set, the marker flush
+  // leaves behind the last of a tick's packets
+  struct OutgoingPacket {
+    unsigned int client_id = 0;
+    std::vector<char> data;
+    bool is_flush = false;
+  };
+
+  void run();
+  // NOTE: both return whether they did anything
+  bool send_queued_packets();
+  bool receive_packets();
+
+  ServerTransport &transport;
+  std::chrono::microseconds idle_poll_interval;
+
+  SpscQueue<ReceivedPacket> incoming;
+  SpscQueue<OutgoingPacket> outgoing;
+
+  std::mutex connected_client_ids_mutex;
+  std::vector<unsigned int> connected_client_ids;
+
+  // NOTE: set when a flush marker didn't fit in the outgoing queue, the I/O
+  // thread then flushes once it has caught up instead
+  std::atomic<bool> flush_requested = false;
+
+  std::atomic<uint64_t> dropped_incoming_count = 0;
+  uint64_t dropped_outgoing_count = 0;
+
+  std::atomic<bool> running = true;
+  // NOTE: last so that everything above exists before the thread starts
+  std::thread io_thread;
+};
+
+#endif // THREADED_TRANSPORT_HPP
@@ -0,0 +1,95 @@
+#ifndef TRANSPORT_HPP
+#define TRANSPORT_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "../packet_data/packet_data.hpp"
+
+// NOTE: sender_client_id is the client the transport received the packet
+// from, unlike the client id written inside a packet it can't be forged, it is
+// empty when the transport can't tell, which is the case for the enet backed
+// Network, the server ignores such packets and runs enet through
+// EnetServerTransport instead
+struct ReceivedPacket {
+  PacketWithSize packet;
+  std::chrono::steady_clock::time_point received_at;
+  std::optional<unsigned int> sender_client_id;
+};
+
+// NOTE: the part of the server's Network that the game logic uses, anything
+// that can move packets between the server and its clients can sit behind it,
+// enet through EnetServerTransport, the enet backed Network through
+// NetworkServerTransport (which can't say who sent what), or an in memory
+// loopback for running clients and server in one process.
+// get_network_events_since_last_tick doesn't say who sent each packet,
+// get_received_packets_since_last_tick does when the transport knows.
+class ServerTransport {
+public:
+  virtual ~ServerTransport() = default;
+
+  virtual std::vector<PacketWithSize> get_network_events_since_last_tick() = 0;
+  // NOTE: the same packets along with when they arrived and who sent them,
+  // transports that don't know when say they arrived now
+  virtual std::vector<ReceivedPacket> get_received_packets_since_last_tick();
+  virtual void unreliable_send(unsigned int client_id, const void *data,
+                               size_t size) = 0;
+  virtual std::vector<unsigned int> get_connected_client_ids() = 0;
+  // NOTE: called once a tick after everything has been sent, transports that
+  // batch sends (see UdpServerTransport) send them here
+  virtual void flush() {}
+};
+
+// NOTE: the client side counterpart of ServerTransport
+class ClientTransport {
+public:
+  virtual ~ClientTransport() = default;
+
+  virtual std::vector<PacketWithSize>
+  get_network_events_received_since_last_tick() = 0;
+  virtual void send_packet(const void *data, size_t size) = 0;
+};
+
+// NOTE: adapters for the enet backed Network classes, these are templates so
+// that this header works with whichever of server_networking and
+// client_networking the project has, the network has to outlive the adapter.
+template <typename Network>
+class NetworkServerTransport : public ServerTransport {
+public:
+  explicit NetworkServerTransport(Network &network) : network(network) {}
+
+  std::vector<PacketWithSize> get_network_events_since_last_tick() override {
+    return network.get_network_events_since_last_tick();
+  }
+  void unreliable_send(unsigned int client_id, const void *data,
+                       size_t size) override {
+    network.unreliable_send(client_id, data, size);
+  }
+  std::vector<unsigned int> get_connected_client_ids() override {
+    return network.get_connected_client_ids();
+  }
+
+private:
+  Network &network;
+};
+
+template <typename Network>
+class NetworkClientTransport : public ClientTransport {
+public:
+  explicit NetworkClientTransport(Network &network) : network(network) {}
+
+  std::vector<PacketWithSize>
+  get_network_events_received_since_last_tick() override {
+    return network.get_network_events_received_since_last_tick();
+  }
+  void send_packet(const void *data, size_t size) override {
+    network.send_packet(data, size);
+  }
+
+private:
+  Network &network;
+};
+
+#endif // TRANSPORT_HPP
@@ -0,0 +1,84 @@
+#include "bvh.hpp"
+
+void Bvh::build(const std::vector<BoundingBox> &boxes) {
+  nodes.clear();
+  primitives.resize(boxes.size());
+  if (boxes.empty()) {
+    return;
+  }
+
+  std::vector<glm::vec3> centers(boxes.size());
+  for (uint32_t i = 0; i < boxes.size(); i++) {
+    primitives[i] = i;
+    centers[i] = boxes[i].get_center();
+  }
+
+  // NOTE: a binary tree with at least one primitive per leaf has fewer than
+  // twice as many nodes as primitives
+  nodes.reserve(2 * boxes.size());
+  nodes.push_back({boxes[0], 0, static_cast<uint32_t>(boxes.size())});
+  build_node(0, boxes, centers);
+}
+
+void Bvh::build_node(uint32_t node_index,
+                     const std::vector<BoundingBox> &boxes,
+                     const std::vector<glm::vec3> &centers) {
+  uint32_t first = nodes[node_index].first;
+  uint32_t count = nodes[node_index].count;
+
+  BoundingBox bounds = boxes[primitives[first]];
+  BoundingBox center_bounds{centers[primitives[first]],
+                            centers[primitives[first]]};
+  for (uint32_t i = first + 1; i < first + count; i++) {
+    bounds.grow(boxes[primitives[i]]);
+    center_bounds.grow({centers[primitives[i]], centers[primitives[i]]});
+  }
+  nodes[node_index].bounds = bounds;
+
+  if (count <= max_leaf_size) {
+    return;
+  }
+
+  glm::vec3 extent = center_bounds.max - center_bounds.min;
+  int axis = 0;
+  if (extent.y > extent.x) {
+    axis = 1;
+  }
+  if (extent.z > (axis == 0 ? extent.x : extent.y)) {
+    axis = 2;
+  }
+
+  uint32_t *begin = primitives.data() + first;
+  uint32_t *middle = begin + count / 2;
+  std::nth_element(begin, middle, begin + count,
+                   [&](uint32_t a, uint32_t b) {
+                     return centers[a][axis] < centers[b][axis];
+                   });
+
+  uint32_t left = static_cast<uint32_t>(nodes.size());
+  nodes.push_back({bounds, first, count / 2});
+  nodes.push_back({bounds, first + count / 2, count - count / 2});
+  nodes[node_index].first = left;
+  nodes[node_index].count = 0;
+
+  build_node(left, boxes, centers);
+  build_node(left + 1, boxes, centers);
+}
+
+float Bvh::intersect(const BoundingBox &bounds, const glm::vec3 &origin,
+                     const glm::vec3 &inverse_direction, float max_fraction) {
+  float entry = 0;
+  float exit = max_fraction;
+  for (int axis = 0; axis < 3; axis++) {
+    float near = (bounds.min[axis] - origin[axis]) * inverse_direction[axis];
+    float far = (bounds.max[axis] - origin[axis]) * inverse_direction[axis];
+    if (near > far) {
+      std::swap(near, far);
+    }
+    // NOTE: written so that a NaN, from a ray parallel to and right on a face
+    // of the box, leaves entry and exit alone
+    entry = near > entry ? near : entry;
+    exit = far < exit ? far : exit;
+  }
+  return entry <= exit ? entry : -1;
+}
@@ -0,0 +1,143 @@
+#ifndef BVH_HPP
+#define BVH_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+struct BoundingBox {
+  glm::vec3 min;
+  glm::vec3 max;
+
+  void grow(const BoundingBox &other) {
+    min = glm::vec3(std::min(min.x, other.min.x), std::min(min.y, other.min.y),
+                    std::min(min.z, other.min.z));
+    max = glm::vec3(std::max(max.x, other.max.x), std::max(max.y, other.max.y),
+                    std::max(max.z, other.max.z));
+  }
+
+  glm::vec3 get_center() const { return 0.5f * (min + max); }
+};
+
+// NOTE: a bounding volume hierarchy, a binary tree of boxes over a set of
+// primitives (each given by its box and referred to by its index in the list
+// it was built from) so that a ray only has to be tested against the
+// primitives whose boxes it passes through, which is about log n boxes and a
+// handful of primitives instead of all n of them. It's rebuilt from scratch
+// whenever the primitives move, splitting each node at the median of the
+// longest axis of its primitives' centers, which keeps it balanced and takes
+// n log n.
+class Bvh {
+public:
+  void build(const std::vector<BoundingBox> &boxes);
+
+  // NOTE: finds the closest primitive the ray origin + fraction * direction
+  // for fraction in [0, max_fraction] hits, returns false if there is none.
+  // cast_against_primitive(primitive, max_fraction) is called for the
+  // primitives whose boxes the ray passes through and returns the fraction
+  // the primitive is hit at, anything at or above max_fraction meaning a miss.
+  // Nearer nodes are visited first and nodes further than the closest hit so
+  // far are skipped.
+  template <typename CastAgainstPrimitive>
+  bool cast_ray(const glm::vec3 &origin, const glm::vec3 &direction,
+                float max_fraction,
+                CastAgainstPrimitive &&cast_against_primitive,
+                uint32_t &hit_primitive, float &hit_fraction) const;
+
+  size_t get_primitive_count() const { return primitives.size(); }
+  size_t get_node_count() const { return nodes.size(); }
+
+private:
+  // NOTE: a leaf holds primitives[first, first + count), an inner node has
+  // count 0 and its children at nodes[first] and nodes[first + 1]
+  struct Node {
+    BoundingBox bounds;
+    uint32_t first;
+    uint32_t count;
+  };
+
+  static constexpr uint32_t max_leaf_size = 4;
+  // NOTE: the median split halves every node so the depth is about
+  // log2(n / max_leaf_size), this covers far more primitives than we'll have
+  static constexpr size_t max_depth = 64;
+
+  void build_node(uint32_t node_index, const std::vector<BoundingBox> &boxes,
+                  const std::vector<glm::vec3> &centers);
+
+  // NOTE: the fraction along the ray where it enters the box, or a negative
+  // number if it misses it within [0, max_fraction]
+  static float intersect(const BoundingBox &bounds, const glm::vec3 &origin,
+                         const glm::vec3 &inverse_direction,
+                         float max_fraction);
+
+  std::vector<Node> nodes;
+  std::vector<uint32_t> primitives;
+};
+
+template <typename CastAgainstPrimitive>
+bool Bvh::cast_ray(const glm::vec3 &origin, const glm::vec3 &direction,
+                   float max_fraction,
+                   CastAgainstPrimitive &&cast_against_primitive,
+                   uint32_t &hit_primitive, float &hit_fraction) const {
+  if (nodes.empty()) {
+    return false;
+  }
+  glm::vec3 inverse_direction(1 / direction.x, 1 / direction.y,
+                              1 / direction.z);
+  bool hit = false;
+  float closest = max_fraction;
+
+  uint32_t stack[max_depth * 2];
+  size_t stack_size = 0;
+  if (intersect(nodes[0].bounds, origin, inverse_direction, closest) >= 0) {
+    stack[stack_size++] = 0;
+  }
+
+  while (stack_size > 0) {
+    const Node &node = nodes[stack[--stack_size]];
+    // NOTE: checked again as a closer hit might have been found since it was
+    // pushed
+    if (intersect(node.bounds, origin, inverse_direction, closest) < 0) {
+      continue;
+    }
+
+    if (node.count > 0) {
+      for (uint32_t i = node.first; i < node.first + node.count; i++) {
+        float fraction = cast_against_primitive(primitives[i], closest);
+        if (fraction < closest) {
+          closest = fraction;
+          hit_primitive = primitives[i];
+          hit = true;
+        }
+      }
+      continue;
+    }
+
+    float left_entry = intersect(nodes[node.first].bounds, origin,
+                                 inverse_direction, closest);
+    float right_entry = intersect(nodes[node.first + 1].bounds, origin,
+                                  inverse_direction, closest);
+    // NOTE: the nearer child goes on top so it's visited first
+    uint32_t near = node.first, far = node.first + 1;
+    float near_entry = left_entry, far_entry = right_entry;
+    if (right_entry >= 0 and (left_entry < 0 or right_entry < left_entry)) {
+      std::swap(near, far);
+      std::swap(near_entry, far_entry);
+    }
+    if (far_entry >= 0) {
+      stack[stack_size++] = far;
+    }
+    if (near_entry >= 0) {
+      stack[stack_size++] = near;
+    }
+  }
+
+  if (hit) {
+    hit_fraction = closest;
+  }
+  return hit;
+}
+
+#endif // BVH_HPP
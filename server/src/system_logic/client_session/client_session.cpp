@@ -0,0 +1,67 @@
+#include "client_session.hpp"
+
+#include <algorithm>
+
+CameraReconstructionData
+get_camera_reconstruction_data(const FPSCamera &fps_camera) {
+  return {fps_camera.transform.get_rotation_yaw(),
+          fps_camera.transform.get_rotation_pitch(),
+          fps_camera.mouse.last_mouse_position_x,
+          fps_camera.mouse.last_mouse_position_y};
+}
+
+void set_camera_state(CameraReconstructionData crd, FPSCamera &fps_camera) {
+  fps_camera.transform.set_rotation_yaw(crd.yaw);
+  fps_camera.transform.set_rotation_pitch(crd.pitch);
+  fps_camera.mouse.last_mouse_position_x = crd.last_mouse_position_x;
+  fps_camera.mouse.last_mouse_position_y = crd.last_mouse_position_y;
+}
+
+ClientSession::ClientSession(unsigned int client_id,
+                             unsigned int max_rewind_ticks)
+    : client_id(client_id),
+      mouse_pos_update_number_to_processed_mouse_update(
+          max_rewind_ticks * processed_mouse_updates_per_tick),
+      update_number_to_camera_reconstruction_data(max_rewind_ticks),
+      update_number_to_sent_game_update(max_rewind_ticks) {}
+
+void ClientSession::acknowledge_game_update(const MouseUpdate &mouse_update) {
+  if (not mouse_update.has_received_game_update) {
+    return;
+  }
+  if (not has_acknowledged_a_game_update or
+      mouse_update.last_received_game_update_number >
+          last_acknowledged_game_update_number) {
+    has_acknowledged_a_game_update = true;
+    last_acknowledged_game_update_number =
+        mouse_update.last_received_game_update_number;
+  }
+}
+
+const GameUpdate *ClientSession::get_delta_baseline() const {
+  if (not has_acknowledged_a_game_update) {
+    return nullptr;
+  }
+  return update_number_to_sent_game_update.get(
+      last_acknowledged_game_update_number);
+}
+
+std::vector<unsigned int> synchronize_client_sessions(
+    ClientSessions &client_sessions,
+    const std::vector<unsigned int> &connected_client_ids,
+    unsigned int max_rewind_ticks) {
+  std::erase_if(client_sessions, [&](const auto &id_and_session) {
+    return std::find(connected_client_ids.begin(), connected_client_ids.end(),
+                     id_and_session.first) == connected_client_ids.end();
+  });
+
+  std::vector<unsigned int> new_client_ids;
+  for (unsigned int client_id : connected_client_ids) {
+    auto [it, inserted] =
+        client_sessions.try_emplace(client_id, client_id, max_rewind_ticks);
+    if (inserted) {
+      new_client_ids.push_back(client_id);
+    }
+  }
+  return new_client_ids;
+}
@@ -0,0 +1,105 @@
+#ifndef CLIENT_SESSION_HPP
+#define CLIENT_SESSION_HPP
+
+#include <map>
+#include <vector>
+
+#include "../../graphics/fps_camera/fps_camera.hpp"
+#include "../../networking/packets/packets.hpp"
+#include "../../utility/temporal_binary_switch/temporal_binary_switch.hpp"
+#include "../entity_snapshot/entity_snapshot.hpp"
+#include "../rewind_history/rewind_history.hpp"
+
+// NOTE: what we need to rebuild a client's view at some past game update
+struct CameraReconstructionData {
+  double yaw;
+  double pitch;
+  double last_mouse_position_x;
+  double last_mouse_position_y;
+  // NOTE: the mouse update the camera had processed up to, not touched by
+  // set_camera_state
+  unsigned int last_processed_mouse_pos_update_number = 0;
+};
+
+CameraReconstructionData
+get_camera_reconstruction_data(const FPSCamera &fps_camera);
+void set_camera_state(CameraReconstructionData crd, FPSCamera &fps_camera);
+
+// NOTE: a shot as reconstructed from a client's inputs, this is worked out for
+// every client in parallel and only applied to the world once they are all
+// done, so it holds the outcome along with what the firing logic logs.
+struct ShotRecord {
+  unsigned int entity_update_number;
+  unsigned int camera_update_number;
+  // NOTE: false when the game updates the shot references have fallen out of
+  // the history, such a shot is rejected and the fields below are unset
+  bool rewind_is_available;
+  double subtick_percentage_when_fire_pressed;
+  double entity_extrapolation_when_fire_pressed;
+  EntitySnapshot target_when_fired;
+  CameraReconstructionData camera_when_fired;
+  bool had_hit;
+  // NOTE: wall clock time spent rewinding and casting the shot
+  double reconstruction_seconds;
+};
+
+// NOTE: everything the server tracks for a single connected client, the world
+// (the target and its history) is shared between all of them, but each client
+// has its own view into it along with the inputs and acknowledgements that
+// drive that view.
+struct ClientSession {
+  ClientSession(unsigned int client_id, unsigned int max_rewind_ticks);
+
+  unsigned int client_id;
+
+  FPSCamera fps_camera;
+  TemporalBinarySwitch fire_tbs;
+
+  std::vector<MouseUpdate> mouse_updates_since_last_tick;
+  // NOTE: mouse updates can be sent more than once (see MOUSE_UPDATE_WINDOW)
+  // and arrive out of order, anything at or before the last processed one is
+  // skipped
+  bool has_processed_a_mouse_update = false;
+  unsigned int last_processed_mouse_pos_update_number = 0;
+  // NOTE: every mouse update that was processed, so that a shot can walk the
+  // exact mouse path from the game update the client fired on up to the click,
+  // sized for up to processed_mouse_updates_per_tick mouse samples per tick
+  // across the rewind window
+  static constexpr unsigned int processed_mouse_updates_per_tick = 16;
+  RewindHistory<MouseUpdate> mouse_pos_update_number_to_processed_mouse_update;
+
+  // NOTE: in the order they were fired
+  std::vector<ShotRecord> shots_this_tick;
+
+  // NOTE: hit and miss feedback only goes to the client that fired
+  std::vector<SoundUpdate> sound_updates_this_tick;
+
+  RewindHistory<CameraReconstructionData>
+      update_number_to_camera_reconstruction_data;
+
+  // NOTE: the game updates sent to this client, used as delta baselines
+  RewindHistory<GameUpdate> update_number_to_sent_game_update;
+  bool has_acknowledged_a_game_update = false;
+  unsigned int last_acknowledged_game_update_number = 0;
+
+  // NOTE: mouse updates can arrive out of order so this only ever moves the
+  // acknowledgement forward
+  void acknowledge_game_update(const MouseUpdate &mouse_update);
+
+  // NOTE: nullptr if nothing usable has been acknowledged, in which case a full
+  // game update has to be sent
+  const GameUpdate *get_delta_baseline() const;
+};
+
+// NOTE: keyed by client id, ordered so that iterating over the sessions is
+// deterministic from one tick to the next
+using ClientSessions = std::map<unsigned int, ClientSession>;
+
+// NOTE: creates sessions for newly connected clients and drops the ones for
+// clients that disconnected, returns the ids of the new clients
+std::vector<unsigned int> synchronize_client_sessions(
+    ClientSessions &client_sessions,
+    const std::vector<unsigned int> &connected_client_ids,
+    unsigned int max_rewind_ticks);
+
+#endif // CLIENT_SESSION_HPP
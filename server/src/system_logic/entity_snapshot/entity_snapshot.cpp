@@ -0,0 +1,67 @@
+#include "entity_snapshot.hpp"
+
+#include "../hermite_interpolation/hermite_interpolation.hpp"
+
+uint32_t EntityShapeRegistry::register_shape(const JPH::Shape *shape) {
+  for (uint32_t shape_id = 0; shape_id < shapes.size(); shape_id++) {
+    if (shapes[shape_id].GetPtr() == shape) {
+      return shape_id;
+    }
+  }
+  shapes.emplace_back(shape);
+  return static_cast<uint32_t>(shapes.size() - 1);
+}
+
+const JPH::Shape *EntityShapeRegistry::get_shape(uint32_t shape_id) const {
+  if (shape_id >= shapes.size()) {
+    return nullptr;
+  }
+  return shapes[shape_id].GetPtr();
+}
+
+EntitySnapshot take_entity_snapshot(const JPH::CharacterVirtual &character,
+                                    EntityShapeRegistry &shape_registry) {
+  EntitySnapshot snapshot;
+  JPH::Vec3(character.GetPosition()).StoreFloat3(&snapshot.position);
+  character.GetLinearVelocity().StoreFloat3(&snapshot.linear_velocity);
+  character.GetRotation().GetXYZW().StoreFloat4(&snapshot.rotation);
+  snapshot.shape_id = shape_registry.register_shape(character.GetShape());
+  return snapshot;
+}
+
+void restore_entity_snapshot(const EntitySnapshot &snapshot,
+                             JPH::CharacterVirtual &character) {
+  character.SetPosition(JPH::Vec3(snapshot.position));
+  character.SetLinearVelocity(JPH::Vec3(snapshot.linear_velocity));
+  character.SetRotation(get_snapshot_rotation(snapshot));
+}
+
+EntitySnapshot interpolate_entity_snapshots(const EntitySnapshot &start,
+                                            const EntitySnapshot &end,
+                                            float duration, float t) {
+  EntitySnapshot interpolated = start;
+
+  JPH::Vec3 position = hermite_interpolate(
+      JPH::Vec3(start.position), JPH::Vec3(start.linear_velocity),
+      JPH::Vec3(end.position), JPH::Vec3(end.linear_velocity), duration, t);
+  position.StoreFloat3(&interpolated.position);
+
+  JPH::Vec3 linear_velocity = (1 - t) * JPH::Vec3(start.linear_velocity) +
+                              t * JPH::Vec3(end.linear_velocity);
+  linear_velocity.StoreFloat3(&interpolated.linear_velocity);
+
+  JPH::Quat start_rotation(JPH::Vec4::sLoadFloat4(&start.rotation));
+  JPH::Quat end_rotation(JPH::Vec4::sLoadFloat4(&end.rotation));
+  start_rotation.SLerp(end_rotation, t).GetXYZW().StoreFloat4(
+      &interpolated.rotation);
+
+  return interpolated;
+}
+
+JPH::Vec3 get_snapshot_position(const EntitySnapshot &snapshot) {
+  return JPH::Vec3(snapshot.position);
+}
+
+JPH::Quat get_snapshot_rotation(const EntitySnapshot &snapshot) {
+  return JPH::Quat(JPH::Vec4::sLoadFloat4(&snapshot.rotation));
+}
@@ -0,0 +1,61 @@
+#ifndef ENTITY_SNAPSHOT_HPP
+#define ENTITY_SNAPSHOT_HPP
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Math/Float3.h>
+#include <Jolt/Math/Float4.h>
+#include <Jolt/Physics/Character/CharacterVirtual.h>
+#include <Jolt/Physics/Collision/Shape/Shape.h>
+
+// NOTE: the rewindable state of an entity for a single game update, unlike a
+// JPH::StateRecorderImpl this is fixed size and trivially copyable, so a
+// history of them is one contiguous block and restoring one is a few plain
+// writes rather than parsing a stream back in with RestoreState.
+struct EntitySnapshot {
+  JPH::Float3 position;
+  JPH::Float3 linear_velocity;
+  // NOTE: stored as xyzw
+  JPH::Float4 rotation;
+  uint32_t shape_id;
+};
+
+static_assert(std::is_trivially_copyable_v<EntitySnapshot>,
+              "entity snapshots are copied around as plain bytes");
+
+// NOTE: snapshots refer to shapes by id so that they stay plain data, this is
+// where those ids are handed out and resolved back into shapes.
+class EntityShapeRegistry {
+public:
+  // NOTE: registering the same shape twice returns the same id
+  uint32_t register_shape(const JPH::Shape *shape);
+  const JPH::Shape *get_shape(uint32_t shape_id) const;
+
+private:
+  std::vector<JPH::RefConst<JPH::Shape>> shapes;
+};
+
+EntitySnapshot take_entity_snapshot(const JPH::CharacterVirtual &character,
+                                    EntityShapeRegistry &shape_registry);
+
+// NOTE: writes position, velocity and rotation back onto the character, the
+// shape is left alone as swapping the shape of a CharacterVirtual requires a
+// collision query, the shape id is there so hitscan can use the historical
+// shape directly.
+void restore_entity_snapshot(const EntitySnapshot &snapshot,
+                             JPH::CharacterVirtual &character);
+
+// NOTE: t = 0 gives start, t = 1 gives end, the shape is taken from start,
+// duration is the time between the two snapshots, the position follows a cubic
+// hermite spline through both positions and velocities like on the client
+EntitySnapshot interpolate_entity_snapshots(const EntitySnapshot &start,
+                                            const EntitySnapshot &end,
+                                            float duration, float t);
+
+JPH::Vec3 get_snapshot_position(const EntitySnapshot &snapshot);
+JPH::Quat get_snapshot_rotation(const EntitySnapshot &snapshot);
+
+#endif // ENTITY_SNAPSHOT_HPP
@@ -0,0 +1,166 @@
+#include "hitscan_history.hpp"
+
+#include <Jolt/Geometry/AABox.h>
+
+#include "../hitscan_logic/hitscan_logic.hpp"
+
+namespace {
+
+glm::vec3 to_glm(const JPH::Float3 &v) { return glm::vec3(v.x, v.y, v.z); }
+
+glm::vec3 to_glm(JPH::Vec3Arg v) {
+  return glm::vec3(v.GetX(), v.GetY(), v.GetZ());
+}
+
+} // namespace
+
+HitscanHistory::HitscanHistory(unsigned int max_rewind_ticks,
+                               const EntityShapeRegistry &shape_registry)
+    : update_number_to_tick(max_rewind_ticks), shape_registry(shape_registry) {
+}
+
+void HitscanHistory::record(unsigned int update_number,
+                            const std::vector<EntitySnapshot> &targets,
+                            float dt) {
+  Tick &tick = update_number_to_tick.record(update_number);
+  tick.targets = targets;
+  tick.dt = dt;
+  // NOTE: looked up after recording, with a window of zero ticks the previous
+  // one shares the slot and is gone
+  const Tick *previous = update_number > 0
+                             ? update_number_to_tick.get(update_number - 1)
+                             : nullptr;
+
+  swept_boxes.clear();
+  for (size_t i = 0; i < targets.size(); i++) {
+    const EntitySnapshot &end = targets[i];
+    glm::vec3 end_position = to_glm(end.position);
+    BoundingBox box{end_position, end_position};
+
+    if (previous != nullptr and i < previous->targets.size()) {
+      // NOTE: the control points of the hermite spline as a bezier curve
+      const EntitySnapshot &start = previous->targets[i];
+      glm::vec3 start_position = to_glm(start.position);
+      glm::vec3 start_control =
+          start_position + (dt / 3) * to_glm(start.linear_velocity);
+      glm::vec3 end_control =
+          end_position - (dt / 3) * to_glm(end.linear_velocity);
+      for (const glm::vec3 &point :
+           {start_position, start_control, end_control}) {
+        box.grow({point, point});
+      }
+    }
+
+    glm::vec3 reach(get_shape_reach(end.shape_id));
+    swept_boxes.push_back({box.min - reach, box.max + reach});
+  }
+  tick.swept_bvh.build(swept_boxes);
+}
+
+bool HitscanHistory::is_within_rewind_window(double update_number) const {
+  if (update_number < 0) {
+    return false;
+  }
+  unsigned int tick = static_cast<unsigned int>(update_number);
+  return update_number_to_tick.get(tick) != nullptr and
+         (update_number == tick or
+          update_number_to_tick.get(tick + 1) != nullptr);
+}
+
+bool HitscanHistory::cast_ray(const JPH::RayCast &aim_ray,
+                              double update_number, size_t &hit_target,
+                              float &hit_fraction,
+                              EntitySnapshot &hit_snapshot) const {
+  Interval interval;
+  if (not get_interval(update_number, interval)) {
+    return false;
+  }
+
+  uint32_t hit_primitive = 0;
+  bool hit = interval.end->swept_bvh.cast_ray(
+      to_glm(aim_ray.mOrigin), to_glm(aim_ray.mDirection),
+      JPH::RayCastResult().mFraction,
+      [&](uint32_t target, float max_fraction) {
+        float fraction = max_fraction;
+        cast_ray_against_snapshot(aim_ray, get_target(interval, target),
+                                  fraction);
+        return fraction;
+      },
+      hit_primitive, hit_fraction);
+  if (hit) {
+    hit_target = hit_primitive;
+    hit_snapshot = get_target(interval, hit_target);
+  }
+  return hit;
+}
+
+bool HitscanHistory::cast_ray_against_every_target(
+    const JPH::RayCast &aim_ray, double update_number, size_t &hit_target,
+    float &hit_fraction, EntitySnapshot &hit_snapshot) const {
+  Interval interval;
+  if (not get_interval(update_number, interval)) {
+    return false;
+  }
+
+  bool hit = false;
+  float fraction = JPH::RayCastResult().mFraction;
+  for (size_t i = 0; i < interval.end->targets.size(); i++) {
+    EntitySnapshot target = get_target(interval, i);
+    if (cast_ray_against_snapshot(aim_ray, target, fraction)) {
+      hit = true;
+      hit_target = i;
+      hit_snapshot = target;
+    }
+  }
+  if (hit) {
+    hit_fraction = fraction;
+  }
+  return hit;
+}
+
+bool HitscanHistory::get_interval(double update_number,
+                                  Interval &interval) const {
+  if (not is_within_rewind_window(update_number)) {
+    return false;
+  }
+  unsigned int tick = static_cast<unsigned int>(update_number);
+  if (update_number == tick) {
+    interval = {nullptr, update_number_to_tick.get(tick), 0};
+  } else {
+    interval = {update_number_to_tick.get(tick),
+                update_number_to_tick.get(tick + 1),
+                static_cast<float>(update_number - tick)};
+  }
+  return true;
+}
+
+EntitySnapshot HitscanHistory::get_target(const Interval &interval,
+                                          size_t target) const {
+  const EntitySnapshot &end = interval.end->targets[target];
+  if (interval.start == nullptr or target >= interval.start->targets.size()) {
+    return end;
+  }
+  return interpolate_entity_snapshots(interval.start->targets[target], end,
+                                      interval.end->dt, interval.t);
+}
+
+bool HitscanHistory::cast_ray_against_snapshot(const JPH::RayCast &aim_ray,
+                                               const EntitySnapshot &snapshot,
+                                               float &fraction) const {
+  return cast_ray_against_target(
+      aim_ray, get_snapshot_position(snapshot),
+      get_snapshot_rotation(snapshot),
+      *shape_registry.get_shape(snapshot.shape_id), fraction);
+}
+
+float HitscanHistory::get_shape_reach(uint32_t shape_id) {
+  if (shape_id >= shape_id_to_reach.size()) {
+    shape_id_to_reach.resize(shape_id + 1, -1);
+  }
+  float &reach = shape_id_to_reach[shape_id];
+  if (reach < 0) {
+    JPH::AABox bounds = shape_registry.get_shape(shape_id)->GetLocalBounds();
+    reach = JPH::Vec3::sMax(bounds.mMin.Abs(), bounds.mMax.Abs()).Length();
+  }
+  return reach;
+}
@@ -0,0 +1,89 @@
+#ifndef HITSCAN_HISTORY_HPP
+#define HITSCAN_HISTORY_HPP
+
+#include <vector>
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Physics/Collision/RayCast.h>
+
+#include "../bvh/bvh.hpp"
+#include "../entity_snapshot/entity_snapshot.hpp"
+#include "../rewind_history/rewind_history.hpp"
+
+// NOTE: the rewind history of many targets, indexed so that a rewound shot
+// doesn't have to restore all of them. Every tick keeps the targets' snapshots
+// along with a Bvh over boxes that each hold everywhere its target could be
+// drawn between the previous tick and this one, a shot at some point between
+// two ticks is cast through the later tick's Bvh and only the targets whose
+// boxes it passes through are interpolated to that point and cast against. So
+// what a shot costs depends on how many targets are near the ray, not on how
+// many there are, and recording a tick costs a Bvh build over them.
+//
+// The targets are interpolated with the hermite spline through their positions
+// and velocities like the client draws them, which stays inside the hull of
+// its bezier control points, so each box is the bounds of those four points
+// grown by how far the shape reaches from its origin in any rotation.
+class HitscanHistory {
+public:
+  HitscanHistory(unsigned int max_rewind_ticks,
+                 const EntityShapeRegistry &shape_registry);
+
+  // NOTE: call once per tick with every target's snapshot, target i has to be
+  // the same target every tick and new targets only ever go at the end, dt is
+  // the time since the previous tick
+  void record(unsigned int update_number,
+              const std::vector<EntitySnapshot> &targets, float dt);
+
+  // NOTE: update_number may have a fractional part, a point between two ticks
+  // needs both of them
+  bool is_within_rewind_window(double update_number) const;
+
+  // NOTE: casts against the targets as they were at update_number, returns
+  // false if nothing was hit or the update number is outside of the rewind
+  // window, otherwise hit_target is the index of the closest target hit and
+  // hit_snapshot is where it was
+  bool cast_ray(const JPH::RayCast &aim_ray, double update_number,
+                size_t &hit_target, float &hit_fraction,
+                EntitySnapshot &hit_snapshot) const;
+
+  // NOTE: the same thing restoring every target, to check against
+  bool cast_ray_against_every_target(const JPH::RayCast &aim_ray,
+                                     double update_number, size_t &hit_target,
+                                     float &hit_fraction,
+                                     EntitySnapshot &hit_snapshot) const;
+
+private:
+  struct Tick {
+    std::vector<EntitySnapshot> targets;
+    // NOTE: over where each target could be between the previous tick and
+    // this one, or just this one when there was none
+    Bvh swept_bvh;
+    float dt = 0;
+  };
+
+  // NOTE: what a rewind to some update number interpolates between, start is
+  // null when it lands right on end's tick
+  struct Interval {
+    const Tick *start;
+    const Tick *end;
+    float t;
+  };
+
+  bool get_interval(double update_number, Interval &interval) const;
+  EntitySnapshot get_target(const Interval &interval, size_t target) const;
+  bool cast_ray_against_snapshot(const JPH::RayCast &aim_ray,
+                                 const EntitySnapshot &snapshot,
+                                 float &fraction) const;
+
+  // NOTE: how far the shape reaches from its origin, cached per shape id
+  float get_shape_reach(uint32_t shape_id);
+
+  RewindHistory<Tick> update_number_to_tick;
+  const EntityShapeRegistry &shape_registry;
+  std::vector<float> shape_id_to_reach;
+  // NOTE: reused for every tick so that recording doesn't allocate once it has
+  // grown to fit
+  std::vector<BoundingBox> swept_boxes;
+};
+
+#endif // HITSCAN_HISTORY_HPP
@@ -0,0 +1,68 @@
+#include "hitscan_world.hpp"
+
+#include <utility>
+
+#include <Jolt/Geometry/AABox.h>
+
+#include "../hitscan_logic/hitscan_logic.hpp"
+
+namespace {
+
+glm::vec3 to_glm(JPH::Vec3Arg v) {
+  return glm::vec3(v.GetX(), v.GetY(), v.GetZ());
+}
+
+} // namespace
+
+void HitscanWorld::set_targets(std::vector<HitscanTarget> targets) {
+  this->targets = std::move(targets);
+
+  std::vector<BoundingBox> boxes;
+  boxes.reserve(this->targets.size());
+  for (const HitscanTarget &target : this->targets) {
+    JPH::AABox bounds = target.shape->GetWorldSpaceBounds(
+        JPH::Mat44::sRotationTranslation(target.rotation, target.position),
+        JPH::Vec3::sReplicate(1.0f));
+    boxes.push_back({to_glm(bounds.mMin), to_glm(bounds.mMax)});
+  }
+  bvh.build(boxes);
+}
+
+bool HitscanWorld::cast_ray(const JPH::RayCast &aim_ray, size_t &hit_target,
+                            float &hit_fraction) const {
+  uint32_t hit_primitive;
+  bool hit = bvh.cast_ray(
+      to_glm(aim_ray.mOrigin), to_glm(aim_ray.mDirection),
+      JPH::RayCastResult().mFraction,
+      [&](uint32_t primitive, float max_fraction) {
+        const HitscanTarget &target = targets[primitive];
+        float fraction = max_fraction;
+        cast_ray_against_target(aim_ray, target.position, target.rotation,
+                                *target.shape, fraction);
+        return fraction;
+      },
+      hit_primitive, hit_fraction);
+  if (hit) {
+    hit_target = hit_primitive;
+  }
+  return hit;
+}
+
+bool HitscanWorld::cast_ray_against_every_target(const JPH::RayCast &aim_ray,
+                                                 size_t &hit_target,
+                                                 float &hit_fraction) const {
+  bool hit = false;
+  float fraction = JPH::RayCastResult().mFraction;
+  for (size_t i = 0; i < targets.size(); i++) {
+    const HitscanTarget &target = targets[i];
+    if (cast_ray_against_target(aim_ray, target.position, target.rotation,
+                                *target.shape, fraction)) {
+      hit = true;
+      hit_target = i;
+    }
+  }
+  if (hit) {
+    hit_fraction = fraction;
+  }
+  return hit;
+}
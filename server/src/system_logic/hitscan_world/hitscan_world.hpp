@@ -0,0 +1,47 @@
+#ifndef HITSCAN_WORLD_HPP
+#define HITSCAN_WORLD_HPP
+
+#include <vector>
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Physics/Collision/RayCast.h>
+#include <Jolt/Physics/Collision/Shape/Shape.h>
+
+#include "../bvh/bvh.hpp"
+
+// NOTE: a target as hitscan sees it, the pose can come from anywhere (the live
+// target or a snapshot), the shape has to outlive the world it's in
+struct HitscanTarget {
+  JPH::Vec3 position;
+  JPH::Quat rotation;
+  const JPH::Shape *shape;
+};
+
+// NOTE: many targets that a shot can hit, the closest one along the ray is
+// the one hit. The targets' bounds go in a Bvh so a shot is only cast against
+// the few targets whose bounds it passes through rather than all of them, it's
+// rebuilt whenever the targets are set, which is once per tick when they move.
+// Nothing is modified by a cast so any number of them can run at once.
+class HitscanWorld {
+public:
+  void set_targets(std::vector<HitscanTarget> targets);
+
+  // NOTE: returns false if no target is hit, otherwise hit_target is its index
+  // in the targets that were set and hit_fraction is how far along the ray it
+  // was hit
+  bool cast_ray(const JPH::RayCast &aim_ray, size_t &hit_target,
+                float &hit_fraction) const;
+
+  // NOTE: the same thing casting against every target, to check against
+  bool cast_ray_against_every_target(const JPH::RayCast &aim_ray,
+                                     size_t &hit_target,
+                                     float &hit_fraction) const;
+
+  size_t get_target_count() const { return targets.size(); }
+
+private:
+  std::vector<HitscanTarget> targets;
+  Bvh bvh;
+};
+
+#endif // HITSCAN_WORLD_HPP
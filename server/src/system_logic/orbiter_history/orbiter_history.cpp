@@ -0,0 +1,92 @@
+#include "orbiter_history.hpp"
+
+#include <cmath>
+
+#include <glm/gtc/constants.hpp>
+
+#include "../hermite_interpolation/hermite_interpolation.hpp"
+
+void OrbiterHistory::record(unsigned int update_number,
+                            const SphereOrbiter &sphere_orbiter, float dt) {
+  latest_update_number = update_number;
+  bool same_motion =
+      not segments.empty() and segments.back().dt == dt and
+      segments.back().sphere_orbiter.has_same_motion(sphere_orbiter);
+  // NOTE: the orbiter steps its angle in floats so it slowly drifts off of
+  // where the segment puts it, once that's noticeable a new segment starts
+  // from where it really is
+  if (not same_motion or
+      glm::length(evaluate(segments.back(), update_number).position -
+                  sphere_orbiter.get_position_at_angle(
+                      sphere_orbiter.get_angle())) > max_position_error) {
+    segments.push_back({update_number, dt, sphere_orbiter});
+  }
+
+  // NOTE: a segment is needed for as long as the oldest tick in the window
+  // falls in it, which is until the next one starts at or before that tick
+  while (segments.size() > 1 and
+         latest_update_number - segments[1].update_number >=
+             max_rewind_ticks) {
+    segments.pop_front();
+  }
+}
+
+bool OrbiterHistory::is_within_rewind_window(double update_number) const {
+  return not segments.empty() and
+         update_number >= segments.front().update_number and
+         update_number <= latest_update_number and
+         latest_update_number - update_number <= max_rewind_ticks;
+}
+
+bool OrbiterHistory::get_state(double update_number,
+                               OrbiterState &state) const {
+  if (not is_within_rewind_window(update_number)) {
+    return false;
+  }
+
+  unsigned int tick = static_cast<unsigned int>(update_number);
+  float fraction = static_cast<float>(update_number - tick);
+  const Segment &segment = get_segment(tick);
+  const Segment &next_segment = get_segment(tick + 1);
+
+  if (fraction == 0 or &next_segment == &segment) {
+    state = evaluate(segment, update_number);
+    return true;
+  }
+
+  // NOTE: the orbit changed on the next tick
+  OrbiterState start = evaluate(segment, tick);
+  OrbiterState end = evaluate(next_segment, tick + 1);
+  state.position =
+      hermite_interpolate(start.position, start.velocity, end.position,
+                          end.velocity, next_segment.dt, fraction);
+  state.velocity = (1 - fraction) * start.velocity + fraction * end.velocity;
+  return true;
+}
+
+OrbiterState OrbiterHistory::evaluate(const Segment &segment,
+                                      double update_number) {
+  // NOTE: worked out in doubles and within a turn as a segment can span a long
+  // time when the target isn't hit
+  const SphereOrbiter &sphere_orbiter = segment.sphere_orbiter;
+  double angle_travelled =
+      double(sphere_orbiter.get_angular_speed()) * segment.dt *
+      (update_number - segment.update_number);
+  float angle = static_cast<float>(
+      sphere_orbiter.get_angle() +
+      std::fmod(angle_travelled, glm::two_pi<double>()));
+  return {sphere_orbiter.get_position_at_angle(angle),
+          sphere_orbiter.get_velocity_at_angle(angle)};
+}
+
+// NOTE: there are only as many segments as orbit changes in the window, which
+// is a handful at most, so a linear scan from the back is plenty
+const OrbiterHistory::Segment &
+OrbiterHistory::get_segment(unsigned int update_number) const {
+  for (auto it = segments.rbegin(); it != segments.rend(); it++) {
+    if (it->update_number <= update_number) {
+      return *it;
+    }
+  }
+  return segments.front();
+}
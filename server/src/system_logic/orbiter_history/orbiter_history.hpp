@@ -0,0 +1,74 @@
+#ifndef ORBITER_HISTORY_HPP
+#define ORBITER_HISTORY_HPP
+
+#include <deque>
+
+#include <glm/glm.hpp>
+
+#include "../sphere_orbiter/sphere_orbiter.hpp"
+
+struct OrbiterState {
+  glm::vec3 position;
+  glm::vec3 velocity;
+};
+
+// NOTE: the rewind history of a SphereOrbiter. The orbit is closed form in the
+// angle and the angle only ever grows by angular_speed * dt per tick, so
+// instead of a snapshot per tick this keeps one segment per stretch of ticks
+// where the motion (and the tick length) stayed the same, which is a new one
+// each time the orbiter is sent off on a different orbit (and every so often
+// to follow the rounding in how the orbiter steps, see record). Any point in the
+// window, including between ticks, is then evaluated on the orbit directly
+// rather than interpolated between snapshots, and a target that is never hit
+// costs a single segment no matter how long the window is.
+//
+// The one exception is the tick the orbit changed on, the orbiter jumps there
+// so there is no true position in between, that stretch is interpolated with
+// a hermite spline between the two ticks like the client draws it.
+class OrbiterHistory {
+public:
+  struct Segment {
+    unsigned int update_number;
+    float dt;
+    // NOTE: as it was after being processed for update_number
+    SphereOrbiter sphere_orbiter;
+  };
+
+  // NOTE: max_position_error is in meters, see record
+  explicit OrbiterHistory(unsigned int max_rewind_ticks,
+                          float max_position_error = 1e-4f)
+      : max_rewind_ticks(max_rewind_ticks),
+        max_position_error(max_position_error) {}
+
+  // NOTE: call once per tick after the orbiter was processed with dt, update
+  // numbers have to increase by one each call
+  void record(unsigned int update_number, const SphereOrbiter &sphere_orbiter,
+              float dt);
+
+  // NOTE: update_number may have a fractional part, returns false if it's
+  // outside of the rewind window, callers are expected to reject the rewind in
+  // that case rather than guessing
+  bool get_state(double update_number, OrbiterState &state) const;
+
+  bool is_within_rewind_window(double update_number) const;
+
+  unsigned int get_max_rewind_ticks() const { return max_rewind_ticks; }
+  unsigned int get_latest_update_number() const {
+    return latest_update_number;
+  }
+  size_t get_segment_count() const { return segments.size(); }
+
+private:
+  // NOTE: where the segment's orbiter is after carrying on for update_number
+  // minus the segment's update number ticks
+  static OrbiterState evaluate(const Segment &segment, double update_number);
+  const Segment &get_segment(unsigned int update_number) const;
+
+  unsigned int max_rewind_ticks;
+  float max_position_error;
+  // NOTE: ordered by update number, the front one may start before the window
+  std::deque<Segment> segments;
+  unsigned int latest_update_number = 0;
+};
+
+#endif // ORBITER_HISTORY_HPP
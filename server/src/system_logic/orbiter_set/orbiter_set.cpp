@@ -0,0 +1,152 @@
+#include "orbiter_set.hpp"
+
+#include <cmath>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define ORBITER_SET_HAS_SSE2
+#include <emmintrin.h>
+#endif
+
+#include "orbiter_set_kernel.hpp"
+
+using orbiter_set_kernel::OrbiterArrays;
+
+namespace {
+
+struct ScalarLanes {
+  using F = float;
+  using I = int32_t;
+  static constexpr size_t width = 1;
+
+  static F set(float value) { return value; }
+  static F load(const float *source) { return *source; }
+  static void store(float *destination, F value) { *destination = value; }
+  static F add(F a, F b) { return a + b; }
+  static F sub(F a, F b) { return a - b; }
+  static F mul(F a, F b) { return a * b; }
+  static F truncate(F a) { return std::trunc(a); }
+  // NOTE: to nearest with ties to even, which is what the vector conversions
+  // do as well
+  static I round_to_int(F a) { return static_cast<I>(std::nearbyint(a)); }
+  static F to_float(I a) { return static_cast<F>(a); }
+  static I bit_and(I a, int32_t b) { return a & b; }
+  static F select(I condition, F a, F b) { return condition != 0 ? a : b; }
+};
+
+#ifdef ORBITER_SET_HAS_SSE2
+struct Sse2Lanes {
+  using F = __m128;
+  using I = __m128i;
+  static constexpr size_t width = 4;
+
+  static F set(float value) { return _mm_set1_ps(value); }
+  static F load(const float *source) { return _mm_loadu_ps(source); }
+  static void store(float *destination, F value) {
+    _mm_storeu_ps(destination, value);
+  }
+  static F add(F a, F b) { return _mm_add_ps(a, b); }
+  static F sub(F a, F b) { return _mm_sub_ps(a, b); }
+  static F mul(F a, F b) { return _mm_mul_ps(a, b); }
+  static F truncate(F a) { return _mm_cvtepi32_ps(_mm_cvttps_epi32(a)); }
+  static I round_to_int(F a) { return _mm_cvtps_epi32(a); }
+  static F to_float(I a) { return _mm_cvtepi32_ps(a); }
+  static I bit_and(I a, int32_t b) {
+    return _mm_and_si128(a, _mm_set1_epi32(b));
+  }
+  static F select(I condition, F a, F b) {
+    F is_zero =
+        _mm_castsi128_ps(_mm_cmpeq_epi32(condition, _mm_setzero_si128()));
+    return _mm_or_ps(_mm_andnot_ps(is_zero, a), _mm_and_ps(is_zero, b));
+  }
+};
+#endif
+
+} // namespace
+
+OrbiterSet::OrbiterSet() : backend(OrbiterSetBackend::SCALAR) {
+  for (OrbiterSetBackend fastest :
+       {OrbiterSetBackend::AVX2, OrbiterSetBackend::SSE2}) {
+    if (set_backend(fastest)) {
+      break;
+    }
+  }
+}
+
+size_t OrbiterSet::add(const SphereOrbiter &sphere_orbiter) {
+  center.push_back(sphere_orbiter.get_center());
+  travel_axis.push_back(glm::normalize(sphere_orbiter.get_travel_axis()));
+  orbit_vector.push_back(sphere_orbiter.get_orbit_vector());
+  angle.push_back(sphere_orbiter.get_angle());
+  angular_speed.push_back(sphere_orbiter.get_angular_speed());
+  position.push_back(
+      sphere_orbiter.get_position_at_angle(sphere_orbiter.get_angle()));
+  velocity.push_back(sphere_orbiter.get_velocity());
+  return size() - 1;
+}
+
+void OrbiterSet::process(float dt) {
+  OrbiterArrays arrays{size(),
+                       angle.data(),
+                       angular_speed.data(),
+                       center.x.data(),
+                       center.y.data(),
+                       center.z.data(),
+                       travel_axis.x.data(),
+                       travel_axis.y.data(),
+                       travel_axis.z.data(),
+                       orbit_vector.x.data(),
+                       orbit_vector.y.data(),
+                       orbit_vector.z.data(),
+                       position.x.data(),
+                       position.y.data(),
+                       position.z.data(),
+                       velocity.x.data(),
+                       velocity.y.data(),
+                       velocity.z.data()};
+
+  size_t processed = 0;
+  switch (backend) {
+  case OrbiterSetBackend::AVX2:
+    processed = orbiter_set_kernel::process_orbiters_avx2(arrays, dt);
+    break;
+  case OrbiterSetBackend::SSE2:
+#ifdef ORBITER_SET_HAS_SSE2
+    processed = orbiter_set_kernel::process_orbiters<Sse2Lanes>(arrays, 0, dt);
+#endif
+    break;
+  case OrbiterSetBackend::SCALAR:
+    break;
+  }
+  // NOTE: whatever is left over doesn't fill a register
+  orbiter_set_kernel::process_orbiters<ScalarLanes>(arrays, processed, dt);
+}
+
+bool OrbiterSet::set_backend(OrbiterSetBackend backend) {
+  if (not is_backend_supported(backend)) {
+    return false;
+  }
+  this->backend = backend;
+  return true;
+}
+
+bool OrbiterSet::is_backend_supported(OrbiterSetBackend backend) {
+  switch (backend) {
+  case OrbiterSetBackend::SCALAR:
+    return true;
+  case OrbiterSetBackend::SSE2:
+#ifdef ORBITER_SET_HAS_SSE2
+    return true;
+#else
+    return false;
+#endif
+  case OrbiterSetBackend::AVX2:
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    return orbiter_set_kernel::has_avx2_kernel() and
+           __builtin_cpu_supports("avx2");
+#else
+    return false;
+#endif
+  }
+  return false;
+}
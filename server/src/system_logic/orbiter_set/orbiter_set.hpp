@@ -0,0 +1,78 @@
+#ifndef ORBITER_SET_HPP
+#define ORBITER_SET_HPP
+
+#include <cstddef>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "../sphere_orbiter/sphere_orbiter.hpp"
+
+enum class OrbiterSetBackend {
+  // NOTE: one orbiter at a time, works everywhere
+  SCALAR,
+  // NOTE: four at a time, always there on x86-64
+  SSE2,
+  // NOTE: eight at a time, only used when the cpu we're running on has it
+  AVX2,
+};
+
+// NOTE: many SphereOrbiters moved together, for when there are far too many
+// targets to step one SphereOrbiter at a time. Every component lives in its
+// own array (structure of arrays) so that process can rotate a whole register
+// of orbiters at once, the rotation is written out with rodrigues' formula and
+// the sine and cosine come from a polynomial instead of glm::rotate. Every
+// backend does the same float operations in the same order, so they all end up
+// with exactly the same positions, which can differ from a SphereOrbiter's by
+// a few micrometers as it uses the standard library's sine and cosine.
+class OrbiterSet {
+public:
+  // NOTE: starts on the fastest backend the cpu supports
+  OrbiterSet();
+
+  // NOTE: returns the index of the orbiter, starting out where sphere_orbiter
+  // is now
+  size_t add(const SphereOrbiter &sphere_orbiter);
+
+  // NOTE: advances every orbiter like SphereOrbiter::process
+  void process(float dt);
+
+  size_t size() const { return angle.size(); }
+  glm::vec3 get_position(size_t index) const { return position.get(index); }
+  glm::vec3 get_velocity(size_t index) const { return velocity.get(index); }
+
+  // NOTE: returns false and leaves the backend alone if the cpu doesn't
+  // support it
+  bool set_backend(OrbiterSetBackend backend);
+  OrbiterSetBackend get_backend() const { return backend; }
+
+  static bool is_backend_supported(OrbiterSetBackend backend);
+
+private:
+  struct Vec3Array {
+    std::vector<float> x, y, z;
+
+    void push_back(const glm::vec3 &value) {
+      x.push_back(value.x);
+      y.push_back(value.y);
+      z.push_back(value.z);
+    }
+    glm::vec3 get(size_t index) const {
+      return glm::vec3(x[index], y[index], z[index]);
+    }
+  };
+
+  OrbiterSetBackend backend;
+
+  Vec3Array center;
+  // NOTE: unit length
+  Vec3Array travel_axis;
+  Vec3Array orbit_vector;
+  std::vector<float> angle;
+  std::vector<float> angular_speed;
+
+  Vec3Array position;
+  Vec3Array velocity;
+};
+
+#endif // ORBITER_SET_HPP
@@ -0,0 +1,61 @@
+#include "orbiter_set_kernel.hpp"
+
+// NOTE: the only file built with AVX2 enabled (see CMakeLists.txt), nothing
+// in here runs unless OrbiterSet::is_backend_supported found the cpu has it.
+// It includes nothing but the kernel and the intrinsics, any inline function
+// from a header used elsewhere too could end up linked in from here with AVX2
+// instructions in it.
+
+#ifdef __AVX2__
+
+#include <immintrin.h>
+
+namespace {
+
+struct Avx2Lanes {
+  using F = __m256;
+  using I = __m256i;
+  static constexpr size_t width = 8;
+
+  static F set(float value) { return _mm256_set1_ps(value); }
+  static F load(const float *source) { return _mm256_loadu_ps(source); }
+  static void store(float *destination, F value) {
+    _mm256_storeu_ps(destination, value);
+  }
+  static F add(F a, F b) { return _mm256_add_ps(a, b); }
+  static F sub(F a, F b) { return _mm256_sub_ps(a, b); }
+  static F mul(F a, F b) { return _mm256_mul_ps(a, b); }
+  static F truncate(F a) {
+    return _mm256_round_ps(a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+  }
+  static I round_to_int(F a) { return _mm256_cvtps_epi32(a); }
+  static F to_float(I a) { return _mm256_cvtepi32_ps(a); }
+  static I bit_and(I a, int32_t b) {
+    return _mm256_and_si256(a, _mm256_set1_epi32(b));
+  }
+  static F select(I condition, F a, F b) {
+    F is_zero = _mm256_castsi256_ps(
+        _mm256_cmpeq_epi32(condition, _mm256_setzero_si256()));
+    return _mm256_blendv_ps(a, b, is_zero);
+  }
+};
+
+} // namespace
+
+size_t orbiter_set_kernel::process_orbiters_avx2(const OrbiterArrays &arrays,
+                                                 float dt) {
+  return process_orbiters<Avx2Lanes>(arrays, 0, dt);
+}
+
+bool orbiter_set_kernel::has_avx2_kernel() { return true; }
+
+#else
+
+size_t orbiter_set_kernel::process_orbiters_avx2(const OrbiterArrays &,
+                                                 float) {
+  return 0;
+}
+
+bool orbiter_set_kernel::has_avx2_kernel() { return false; }
+
+#endif
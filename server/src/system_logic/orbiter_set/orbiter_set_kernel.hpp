@@ -0,0 +1,156 @@
+#ifndef ORBITER_SET_KERNEL_HPP
+#define ORBITER_SET_KERNEL_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+// NOTE: the body of OrbiterSet::process, written once against a Lanes type
+// that holds Lanes::width floats (F) or int32s (I) and provides
+//
+//   F set(float), F load(const float *), void store(float *, F),
+//   F add(F, F), F sub(F, F), F mul(F, F), F truncate(F),
+//   I round_to_int(F), F to_float(I), I bit_and(I, int32_t),
+//   F select(I, F, F) (the first F in lanes where the I is non zero)
+//
+// It's only included by the files that define a Lanes type so that each can be
+// built with the instruction set it needs.
+
+namespace orbiter_set_kernel {
+
+// NOTE: OrbiterSet's arrays, as plain pointers so that this doesn't need
+// anything else from the standard library or glm, see orbiter_set_avx2.cpp
+struct OrbiterArrays {
+  size_t count;
+  float *angle;
+  const float *angular_speed;
+  const float *center_x, *center_y, *center_z;
+  const float *travel_axis_x, *travel_axis_y, *travel_axis_z;
+  const float *orbit_vector_x, *orbit_vector_y, *orbit_vector_z;
+  float *position_x, *position_y, *position_z;
+  float *velocity_x, *velocity_y, *velocity_z;
+};
+
+// NOTE: defined in orbiter_set_avx2.cpp, does nothing and returns 0 when that
+// wasn't built for AVX2
+size_t process_orbiters_avx2(const OrbiterArrays &arrays, float dt);
+bool has_avx2_kernel();
+
+constexpr float two_pi = 6.28318530717958647692f;
+constexpr float half_pi = 1.57079632679489661923f;
+// NOTE: half_pi split in two so that subtracting a multiple of it loses less
+// precision
+constexpr float half_pi_high = 1.5703125f;
+constexpr float half_pi_low = 4.83826794897e-4f;
+
+// NOTE: for angle in [-2 pi, 2 pi], the angle is brought into
+// [-pi / 4, pi / 4] by taking out the nearest quarter turn, where the taylor
+// series up to x^9 for sine and x^8 for cosine are accurate to a float, the
+// quarter turn then decides which of the two each one is and its sign (the low
+// bits of a negative count of quarter turns work out the same)
+template <typename Lanes>
+void sincos(typename Lanes::F angle, typename Lanes::F &sine,
+            typename Lanes::F &cosine) {
+  using L = Lanes;
+  typename L::I quarter_turns =
+      L::round_to_int(L::mul(angle, L::set(1 / half_pi)));
+  typename L::F q = L::to_float(quarter_turns);
+  typename L::F x = L::sub(L::sub(angle, L::mul(q, L::set(half_pi_high))),
+                           L::mul(q, L::set(half_pi_low)));
+  typename L::F x2 = L::mul(x, x);
+
+  typename L::F s = L::set(1.0f / 362880);
+  s = L::add(L::mul(s, x2), L::set(-1.0f / 5040));
+  s = L::add(L::mul(s, x2), L::set(1.0f / 120));
+  s = L::add(L::mul(s, x2), L::set(-1.0f / 6));
+  s = L::add(L::mul(L::mul(s, x2), x), x);
+
+  typename L::F c = L::set(1.0f / 40320);
+  c = L::add(L::mul(c, x2), L::set(-1.0f / 720));
+  c = L::add(L::mul(c, x2), L::set(1.0f / 24));
+  c = L::add(L::mul(c, x2), L::set(-1.0f / 2));
+  c = L::add(L::mul(c, x2), L::set(1.0f));
+
+  // NOTE: sin(x + q pi / 2) is sin x, cos x, -sin x, -cos x for q = 0 to 3,
+  // the cosine is the same a quarter turn on
+  typename L::I odd = L::bit_and(quarter_turns, 1);
+  typename L::F swapped_sine = L::select(odd, c, s);
+  typename L::F swapped_cosine = L::select(odd, s, c);
+  typename L::F negated_sine = L::sub(L::set(0), swapped_sine);
+  typename L::F negated_cosine = L::sub(L::set(0), swapped_cosine);
+  sine = L::select(L::bit_and(quarter_turns, 2), negated_sine, swapped_sine);
+  cosine = L::select(L::bit_and(L::round_to_int(L::add(q, L::set(1))), 2),
+                     negated_cosine, swapped_cosine);
+}
+
+// NOTE: processes the orbiters from begin on, as many whole registers of
+// Lanes::width as fit, and returns where it stopped
+template <typename Lanes>
+size_t process_orbiters(const OrbiterArrays &arrays, size_t begin, float dt) {
+  using L = Lanes;
+  using F = typename L::F;
+  const OrbiterArrays &o = arrays;
+
+  size_t i = begin;
+  for (; i + L::width <= o.count; i += L::width) {
+    // NOTE: kept within a turn like SphereOrbiter does, the angle only ever
+    // moves by less than a turn at a time so this takes out at most one, which
+    // is exact and gives the same angle as its std::fmod does
+    F a = L::add(L::load(&o.angle[i]),
+                 L::mul(L::load(&o.angular_speed[i]), L::set(dt)));
+    a = L::sub(a, L::mul(L::truncate(L::mul(a, L::set(1 / two_pi))),
+                         L::set(two_pi)));
+    L::store(&o.angle[i], a);
+
+    F sine, cosine;
+    sincos<L>(a, sine, cosine);
+
+    F kx = L::load(&o.travel_axis_x[i]);
+    F ky = L::load(&o.travel_axis_y[i]);
+    F kz = L::load(&o.travel_axis_z[i]);
+    F vx = L::load(&o.orbit_vector_x[i]);
+    F vy = L::load(&o.orbit_vector_y[i]);
+    F vz = L::load(&o.orbit_vector_z[i]);
+
+    // NOTE: rodrigues' formula, v rotated about unit axis k is
+    // v cos + (k x v) sin + k (k . v) (1 - cos)
+    F k_dot_v =
+        L::add(L::add(L::mul(kx, vx), L::mul(ky, vy)), L::mul(kz, vz));
+    F cx = L::sub(L::mul(ky, vz), L::mul(kz, vy));
+    F cy = L::sub(L::mul(kz, vx), L::mul(kx, vz));
+    F cz = L::sub(L::mul(kx, vy), L::mul(ky, vx));
+    F axial = L::mul(k_dot_v, L::sub(L::set(1), cosine));
+
+    L::store(&o.position_x[i],
+             L::add(L::load(&o.center_x[i]),
+                    L::add(L::add(L::mul(vx, cosine), L::mul(cx, sine)),
+                           L::mul(kx, axial))));
+    L::store(&o.position_y[i],
+             L::add(L::load(&o.center_y[i]),
+                    L::add(L::add(L::mul(vy, cosine), L::mul(cy, sine)),
+                           L::mul(ky, axial))));
+    L::store(&o.position_z[i],
+             L::add(L::load(&o.center_z[i]),
+                    L::add(L::add(L::mul(vz, cosine), L::mul(cz, sine)),
+                           L::mul(kz, axial))));
+
+    // NOTE: the derivative, angular speed times k x (the rotated v), which is
+    // (k x v) cos + (k (k . v) - v) sin
+    F w = L::load(&o.angular_speed[i]);
+    F w_cosine = L::mul(w, cosine);
+    F w_sine = L::mul(w, sine);
+    L::store(&o.velocity_x[i],
+             L::add(L::mul(cx, w_cosine),
+                    L::mul(L::sub(L::mul(kx, k_dot_v), vx), w_sine)));
+    L::store(&o.velocity_y[i],
+             L::add(L::mul(cy, w_cosine),
+                    L::mul(L::sub(L::mul(ky, k_dot_v), vy), w_sine)));
+    L::store(&o.velocity_z[i],
+             L::add(L::mul(cz, w_cosine),
+                    L::mul(L::sub(L::mul(kz, k_dot_v), vz), w_sine)));
+  }
+  return i;
+}
+
+} // namespace orbiter_set_kernel
+
+#endif // ORBITER_SET_KERNEL_HPP
@@ -0,0 +1,2 @@
+#include "rewind_history.hpp"
+
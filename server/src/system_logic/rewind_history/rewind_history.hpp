@@ -0,0 +1,77 @@
+#ifndef REWIND_HISTORY_HPP
+#define REWIND_HISTORY_HPP
+
+#include <vector>
+
+// NOTE: a fixed capacity history of per-tick values, used for lag compensation
+// on the server and for delta compression baselines on both ends, the value for
+// an update number lives at slot update_number % capacity, so recording a new
+// tick silently overwrites the one that fell out of the rewind window, this
+// keeps memory bounded no matter how long the program runs.
+template <typename T> class RewindHistory {
+public:
+  explicit RewindHistory(unsigned int max_rewind_ticks)
+      : max_rewind_ticks(max_rewind_ticks), slots(max_rewind_ticks + 1) {}
+
+  // NOTE: returns the slot for this update number so it can be written in
+  // place, whatever was recorded there max_rewind_ticks + 1 updates ago is
+  // discarded. Recording an update number older than the rewind window would
+  // discard a newer one, check is_older_than_rewind_window first when they can
+  // arrive out of order.
+  T &record(unsigned int update_number) {
+    Slot &slot = slots[update_number % slots.size()];
+    slot.update_number = update_number;
+    slot.occupied = true;
+
+    if (not has_recorded_anything or update_number > latest_update_number) {
+      latest_update_number = update_number;
+    }
+    has_recorded_anything = true;
+    return slot.value;
+  }
+
+  // NOTE: returns nullptr if the update number is outside of the rewind window
+  // or was never recorded, callers are expected to reject the rewind in that
+  // case rather than guessing.
+  T *get(unsigned int update_number) {
+    if (not is_within_rewind_window(update_number)) {
+      return nullptr;
+    }
+    Slot &slot = slots[update_number % slots.size()];
+    if (not slot.occupied or slot.update_number != update_number) {
+      return nullptr;
+    }
+    return &slot.value;
+  }
+
+  const T *get(unsigned int update_number) const {
+    return const_cast<RewindHistory *>(this)->get(update_number);
+  }
+
+  bool is_within_rewind_window(unsigned int update_number) const {
+    return has_recorded_anything and update_number <= latest_update_number and
+           latest_update_number - update_number <= max_rewind_ticks;
+  }
+
+  bool is_older_than_rewind_window(unsigned int update_number) const {
+    return has_recorded_anything and update_number < latest_update_number and
+           latest_update_number - update_number > max_rewind_ticks;
+  }
+
+  unsigned int get_max_rewind_ticks() const { return max_rewind_ticks; }
+  unsigned int get_latest_update_number() const { return latest_update_number; }
+
+private:
+  struct Slot {
+    unsigned int update_number = 0;
+    bool occupied = false;
+    T value{};
+  };
+
+  unsigned int max_rewind_ticks;
+  std::vector<Slot> slots;
+  unsigned int latest_update_number = 0;
+  bool has_recorded_anything = false;
+};
+
+#endif // REWIND_HISTORY_HPP
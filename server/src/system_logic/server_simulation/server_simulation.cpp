@@ -0,0 +1,540 @@
+#include "server_simulation.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <span>
+#include <string>
+
+#include <Jolt/Physics/Collision/RayCast.h>
+#include <Jolt/Physics/Collision/Shape/Shape.h>
+
+#include <glm/glm.hpp>
+
+#include "../../networking/wire_format/wire_format.hpp"
+#include "../../sound/sound_types/sound_types.hpp"
+#include "../../utility/jolt_glm_type_conversions/jolt_glm_type_conversions.hpp"
+#include "../../utility/logger/logger.hpp"
+#include "../hermite_interpolation/hermite_interpolation.hpp"
+#include "../hitscan_logic/hitscan_logic.hpp"
+#include "../random_vector/random_vector.hpp"
+
+ServerSimulation::ServerSimulation(const ServerSimulationSettings &settings,
+                                   ServerTransport &transport,
+                                   meta_program::MetaProgram &mp)
+    : settings(settings), transport(transport), mp(mp),
+      sphere_orbiter(glm::vec3(0.0f, 1, 0), room_size / 2,
+                     glm::vec3(0.0f, 1.0f, 0.0f), glm::radians(90.0f), 0.0f),
+      physics_target(physics.create_character(0)),
+      worker_pool(settings.worker_threads),
+      sphere_orbiter_history(settings.max_rewind_ticks) {
+  register_packet_handlers();
+}
+
+void ServerSimulation::register_packet_handlers() {
+  packet_handler.register_handler(
+      PacketType::MOUSE_UPDATE, [this](std::vector<uint8_t> raw_packet) {
+        LogSection _(global_logger, "mouse update handler");
+        MouseUpdatePacket packet;
+        if (not wire_format::deserialize(std::span<const uint8_t>(raw_packet),
+                                         packet)) {
+          global_logger.warn(
+              "dropping mouse update packet, only received {} bytes",
+              raw_packet.size());
+          return;
+        }
+        auto session = find_sender_session(packet.mouse_update.client_id);
+        if (session == client_sessions.end()) {
+          global_logger.warn(
+              "dropping mouse update packet from unknown client {}",
+              packet.mouse_update.client_id);
+          return;
+        }
+        packet.mouse_update.client_id = session->first;
+        global_logger.info("just received mouse update packet: {}",
+                           mp.MouseUpdatePacket_to_string(packet));
+        session->second.mouse_updates_since_last_tick.push_back(
+            packet.mouse_update);
+      });
+
+  packet_handler.register_handler(
+      PacketType::MOUSE_UPDATE_QUANTIZED,
+      [this](std::vector<uint8_t> raw_packet) {
+        LogSection _(global_logger, "quantized mouse update handler");
+        unsigned int client_id;
+        if (not wire_format::peek_client_id_of_quantized_mouse_update(
+                raw_packet, client_id)) {
+          global_logger.warn("dropping quantized mouse update packet, only "
+                             "received {} bytes",
+                             raw_packet.size());
+          return;
+        }
+        auto session = find_sender_session(client_id);
+        if (session == client_sessions.end()) {
+          global_logger.warn(
+              "dropping quantized mouse update packet from unknown client {}",
+              client_id);
+          return;
+        }
+        MouseUpdate just_received_mouse_update;
+        wire_format::ByteReader reader(raw_packet);
+        if (not wire_format::deserialize_quantized(
+                reader, just_received_mouse_update,
+                session->second.last_processed_mouse_pos_update_number,
+                update_number)) {
+          global_logger.warn("dropping quantized mouse update packet, only "
+                             "received {} bytes",
+                             raw_packet.size());
+          return;
+        }
+        just_received_mouse_update.client_id = session->first;
+        global_logger.info("just received quantized mouse update: {}",
+                           mp.MouseUpdate_to_string(just_received_mouse_update));
+        session->second.mouse_updates_since_last_tick.push_back(
+            just_received_mouse_update);
+      });
+
+  // NOTE: the window repeats mouse updates that were already sent, the ones
+  // which have been processed are skipped in replay_mouse_updates
+  packet_handler.register_handler(
+      PacketType::MOUSE_UPDATE_WINDOW, [this](std::vector<uint8_t> raw_packet) {
+        LogSection _(global_logger, "mouse update window handler");
+        unsigned int client_id;
+        if (not wire_format::peek_client_id_of_quantized_mouse_update(
+                raw_packet, client_id)) {
+          global_logger.warn(
+              "dropping mouse update window packet, only received {} bytes",
+              raw_packet.size());
+          return;
+        }
+        auto session = find_sender_session(client_id);
+        if (session == client_sessions.end()) {
+          global_logger.warn(
+              "dropping mouse update window packet from unknown client {}",
+              client_id);
+          return;
+        }
+        wire_format::ByteReader reader(raw_packet);
+        size_t mouse_update_count_before =
+            session->second.mouse_updates_since_last_tick.size();
+        if (not wire_format::deserialize_mouse_update_window(
+                reader, session->second.mouse_updates_since_last_tick,
+                session->second.last_processed_mouse_pos_update_number,
+                update_number)) {
+          global_logger.warn(
+              "dropping mouse update window packet, only received {} bytes",
+              raw_packet.size());
+          return;
+        }
+        for (size_t i = mouse_update_count_before;
+             i < session->second.mouse_updates_since_last_tick.size(); i++) {
+          session->second.mouse_updates_since_last_tick[i].client_id =
+              session->first;
+        }
+        global_logger.info(
+            "just received mouse update window holding {} mouse updates",
+            session->second.mouse_updates_since_last_tick.size() -
+                mouse_update_count_before);
+      });
+}
+
+ClientSessions::iterator
+ServerSimulation::find_sender_session(unsigned int claimed_client_id) {
+  // NOTE: anyone can write another client's id into a packet, so one the
+  // transport can't attribute to a connection is never trusted
+  if (not sender_client_id_of_packet_being_handled) {
+    global_logger.warn("the transport can't tell who sent a packet claiming "
+                       "to be from client {}, ignoring it",
+                       claimed_client_id);
+    return client_sessions.end();
+  }
+  unsigned int sender_client_id = *sender_client_id_of_packet_being_handled;
+  // NOTE: a client doesn't know its id until its first game update arrives,
+  // so this alone isn't a reason to drop the packet
+  if (claimed_client_id != sender_client_id) {
+    global_logger.debug("client {} sent a packet claiming to be from client {}",
+                        sender_client_id, claimed_client_id);
+  }
+  return client_sessions.find(sender_client_id);
+}
+
+void ServerSimulation::replay_mouse_updates(ClientSession &session) {
+  for (const MouseUpdate &mu : session.mouse_updates_since_last_tick) {
+    if (session.has_processed_a_mouse_update and
+        mu.mouse_pos_update_number <=
+            session.last_processed_mouse_pos_update_number) {
+      continue;
+    }
+    session.fps_camera.mouse_callback(mu.x_pos, mu.y_pos, mu.sensitivity);
+    session.has_processed_a_mouse_update = true;
+    session.last_processed_mouse_pos_update_number = mu.mouse_pos_update_number;
+    session.mouse_pos_update_number_to_processed_mouse_update.record(
+        mu.mouse_pos_update_number) = mu;
+    session.acknowledge_game_update(mu);
+
+    if (mu.fire_pressed) {
+      session.fire_tbs.set_true();
+    } else {
+      session.fire_tbs.set_false();
+    }
+
+    if (not session.fire_tbs.just_switched_on()) {
+      continue;
+    }
+
+    auto reconstruction_start = std::chrono::steady_clock::now();
+
+    ShotRecord shot{};
+    shot.entity_update_number =
+        mu.last_applied_game_update_number_before_firing_entity_interpolation;
+    shot.camera_update_number =
+        mu.last_applied_game_update_number_before_firing_camera_cpsr;
+    shot.subtick_percentage_when_fire_pressed =
+        mu.subtick_percentage_when_fire_pressed;
+    shot.entity_extrapolation_when_fire_pressed =
+        mu.entity_extrapolation_when_fire_pressed;
+
+    // NOTE: the target is evaluated on its orbit at the exact point the client
+    // fired at, or dead reckoned from the game update the client had run out
+    // at, subtick firing also needs the camera state to rebuild the view from
+    double target_update_number = shot.entity_update_number;
+    double target_extrapolation = 0;
+    if (settings.subtick_firing_accuracy) {
+      target_update_number += mu.subtick_percentage_when_fire_pressed;
+      target_extrapolation = mu.entity_extrapolation_when_fire_pressed;
+    }
+    shot.rewind_is_available =
+        rewind_target(target_update_number, target_extrapolation,
+                      shot.target_when_fired) and
+        (not settings.subtick_firing_accuracy or
+         session.update_number_to_camera_reconstruction_data.get(
+             shot.camera_update_number) != nullptr);
+
+    if (not shot.rewind_is_available) {
+      session.shots_this_tick.push_back(shot);
+      continue;
+    }
+
+    JPH::RayCast aim_ray;
+    if (settings.subtick_firing_accuracy) {
+      // NOTE: rebuild the view the client had when they fired, then put the
+      // camera back
+      CameraReconstructionData current_crd =
+          get_camera_reconstruction_data(session.fps_camera);
+      const CameraReconstructionData &crd_when_fired =
+          *session.update_number_to_camera_reconstruction_data.get(
+              shot.camera_update_number);
+      set_camera_state(crd_when_fired, session.fps_camera);
+      replay_mouse_path(session,
+                        crd_when_fired.last_processed_mouse_pos_update_number,
+                        mu.mouse_pos_update_number);
+      session.fps_camera.mouse_callback(mu.subtick_x_pos_before_firing,
+                                        mu.subtick_y_pos_before_firing,
+                                        mu.sensitivity);
+      shot.camera_when_fired =
+          get_camera_reconstruction_data(session.fps_camera);
+      aim_ray = make_aim_ray(session.fps_camera);
+      set_camera_state(current_crd, session.fps_camera);
+    } else {
+      // NOTE: no camera "revert logic" because there is no subtick camera, and
+      // wherever the server thinks it is is correct in this configuration
+      shot.camera_when_fired =
+          get_camera_reconstruction_data(session.fps_camera);
+      aim_ray = make_aim_ray(session.fps_camera);
+    }
+
+    // NOTE: the shot is cast against the target as it was in the snapshot, the
+    // live target is never moved
+    const JPH::Shape &target_shape =
+        *entity_shape_registry.get_shape(shot.target_when_fired.shape_id);
+    shot.had_hit = run_hitscan_logic(
+        aim_ray, get_snapshot_position(shot.target_when_fired),
+        get_snapshot_rotation(shot.target_when_fired), target_shape);
+
+    shot.reconstruction_seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                      reconstruction_start)
+            .count();
+    session.shots_this_tick.push_back(shot);
+  }
+  session.mouse_updates_since_last_tick.clear();
+}
+
+bool ServerSimulation::rewind_target(double update_number, double extrapolation,
+                                     EntitySnapshot &snapshot) const {
+  OrbiterState state;
+  if (not sphere_orbiter_history.get_state(update_number, state)) {
+    return false;
+  }
+  snapshot = current_target_snapshot;
+  // NOTE: the same dead reckoning the client does when it runs out of game
+  // updates, from the state it was sent for that tick rather than further
+  // along the orbit
+  glm::vec3 position = extrapolate_position(
+      state.position, state.velocity, static_cast<float>(extrapolation));
+  g2j(position).StoreFloat3(&snapshot.position);
+  g2j(state.velocity).StoreFloat3(&snapshot.linear_velocity);
+  return true;
+}
+
+void ServerSimulation::replay_mouse_path(
+    ClientSession &session, unsigned int after_mouse_pos_update_number,
+    unsigned int before_mouse_pos_update_number) {
+  const RewindHistory<MouseUpdate> &history =
+      session.mouse_pos_update_number_to_processed_mouse_update;
+  if (before_mouse_pos_update_number <= after_mouse_pos_update_number) {
+    return;
+  }
+  // NOTE: nothing older than the history is around anyway
+  unsigned int oldest_in_history =
+      before_mouse_pos_update_number -
+      std::min(before_mouse_pos_update_number, history.get_max_rewind_ticks());
+  unsigned int first =
+      std::max(after_mouse_pos_update_number + 1, oldest_in_history);
+  for (unsigned int n = first; n < before_mouse_pos_update_number; n++) {
+    if (const MouseUpdate *mu = history.get(n)) {
+      session.fps_camera.mouse_callback(mu->x_pos, mu->y_pos, mu->sensitivity);
+    }
+  }
+}
+
+void ServerSimulation::resolve_shots(ClientSession &session) {
+  auto jvec3_to_string = [](const JPH::Vec3 &v) {
+    return fmt::format("({}, {}, {})", v.GetX(), v.GetY(), v.GetZ());
+  };
+
+  for (const ShotRecord &shot : session.shots_this_tick) {
+    LogSection _(global_logger, "firing logic");
+    statistics.shots++;
+
+    if (not shot.rewind_is_available) {
+      statistics.rejected_shots++;
+      global_logger.warn(
+          "rejecting shot from client {} fired on game update {} (camera {}), "
+          "it is not within the last {} recorded game updates",
+          session.client_id, shot.entity_update_number,
+          shot.camera_update_number, settings.max_rewind_ticks);
+      SoundUpdate sound_update(SoundType::SERVER_MISS, 0, 0, 0);
+      session.sound_updates_this_tick.push_back(sound_update);
+      continue;
+    }
+
+    statistics.shot_reconstruction_seconds += shot.reconstruction_seconds;
+    JPH::Vec3 current_position = physics_target->GetPosition();
+
+    if (settings.subtick_firing_accuracy) {
+      global_logger.debug("subtick percentage when fire pressed: {}",
+                          shot.subtick_percentage_when_fire_pressed);
+      global_logger.debug("entity extrapolation when fire pressed: {} s",
+                          shot.entity_extrapolation_when_fire_pressed);
+      global_logger.debug(
+          "camera reconstruction from game update {}: yaw={}, pitch={}",
+          shot.camera_update_number, shot.camera_when_fired.yaw,
+          shot.camera_when_fired.pitch);
+    }
+
+    JPH::Vec3 restored_position = get_snapshot_position(shot.target_when_fired);
+    global_logger.debug(
+        "client {} fired at the target at: {} while it is now at: {}",
+        session.client_id, jvec3_to_string(restored_position),
+        jvec3_to_string(current_position));
+
+    if (shot.had_hit) {
+
+      global_logger.debug(
+          "hit target lagunbfe: {} at: {} with lagunbfc: {} yaw, pitch {}, {}",
+          shot.entity_update_number, jvec3_to_string(restored_position),
+          shot.camera_update_number, shot.camera_when_fired.yaw,
+          shot.camera_when_fired.pitch);
+
+      statistics.hits++;
+      if (settings.move_target_on_hit) {
+        sphere_orbiter.set_travel_axis(random_unit_vector());
+        sphere_orbiter.set_radius(random_float(room_size / 4, room_size / 2));
+        sphere_orbiter.set_angular_speed(
+            random_float(glm::radians(45.0f), glm::radians(180.0f)));
+      }
+      SoundUpdate sound_update(SoundType::SERVER_HIT, 0, 0, 0);
+      session.sound_updates_this_tick.push_back(sound_update);
+    } else {
+
+      global_logger.debug(
+          "missed target lagunbf: {} at: {} with lagunbfc: {} yaw, pitch {}, {}",
+          shot.entity_update_number, jvec3_to_string(restored_position),
+          shot.camera_update_number, shot.camera_when_fired.yaw,
+          shot.camera_when_fired.pitch);
+
+      SoundUpdate sound_update(SoundType::SERVER_MISS, 0, 0, 0);
+      session.sound_updates_this_tick.push_back(sound_update);
+    }
+  }
+  session.shots_this_tick.clear();
+}
+
+void ServerSimulation::write_game_update(ClientSession &session,
+                                         const GameUpdate &gu,
+                                         wire_format::ByteWriter &writer) {
+  if (settings.send_delta_game_updates) {
+    const GameUpdate *baseline = session.get_delta_baseline();
+    wire_format::serialize_delta(gu, baseline, writer);
+    global_logger.info(
+        "writing delta game update against baseline {}: {}:",
+        baseline != nullptr ? std::to_string(baseline->update_number) : "none",
+        mp.GameUpdate_to_string(gu));
+  } else if (settings.send_quantized_packets) {
+    wire_format::serialize_quantized(
+        gu, not session.has_acknowledged_a_game_update, writer);
+    global_logger.info("writing quantized game update: {}:",
+                       mp.GameUpdate_to_string(gu));
+  } else {
+    GameUpdatePacket gup;
+    gup.header.type = PacketType::GAME_UPDATE;
+    gup.header.size_of_data_without_header =
+        wire_format::size_when_serialized<GameUpdate>;
+    gup.game_update = gu;
+    wire_format::serialize(gup, writer);
+    global_logger.info("writing game update packet: {}:",
+                       mp.GameUpdatePacket_to_string(gup));
+  }
+  session.update_number_to_sent_game_update.record(gu.update_number) = gu;
+}
+
+void ServerSimulation::write_sound_update(const SoundUpdate &su,
+                                          wire_format::ByteWriter &writer) {
+  SoundUpdatePacket sup;
+  sup.header.type = PacketType::SOUND_UPDATE;
+  sup.header.size_of_data_without_header =
+      wire_format::size_when_serialized<SoundUpdate>;
+  sup.sound_update = su;
+  wire_format::serialize(sup, writer);
+  global_logger.info("writing sound update packet: {}:",
+                     mp.SoundUpdatePacket_to_string(sup));
+}
+
+void ServerSimulation::send_game_frame(ClientSession &session,
+                                       const GameUpdate &gu) {
+  wire_format::start_game_frame(game_frame);
+  wire_format::ByteWriter writer(game_frame);
+  write_game_update(session, gu, writer);
+  for (const auto &su : session.sound_updates_this_tick) {
+    write_sound_update(su, writer);
+  }
+  wire_format::finish_game_frame(game_frame);
+  transport.unreliable_send(session.client_id, game_frame.data(),
+                            game_frame.size());
+  global_logger.info(
+      "just sent game frame with {} sound updates to client {} in {} bytes",
+      session.sound_updates_this_tick.size(), session.client_id,
+      game_frame.size());
+  session.sound_updates_this_tick.clear();
+}
+
+void ServerSimulation::send_game_update(ClientSession &session,
+                                        const GameUpdate &gu) {
+  std::array<uint8_t, std::max({wire_format::max_size_when_delta_game_update,
+                                wire_format::max_size_when_quantized_game_update,
+                                wire_format::size_when_serialized<
+                                    GameUpdatePacket>})>
+      buffer;
+  wire_format::ByteWriter writer(buffer);
+  write_game_update(session, gu, writer);
+  transport.unreliable_send(session.client_id, buffer.data(),
+                            writer.get_bytes_written());
+}
+
+void ServerSimulation::send_sound_updates(ClientSession &session) {
+  for (const auto &su : session.sound_updates_this_tick) {
+    wire_format::FixedSizeBuffer<SoundUpdatePacket> buffer;
+    wire_format::ByteWriter writer(buffer);
+    write_sound_update(su, writer);
+    transport.unreliable_send(session.client_id, buffer.data(), buffer.size());
+  }
+  session.sound_updates_this_tick.clear();
+}
+
+void ServerSimulation::tick(double dt) {
+  LogSection _(global_logger, "tick");
+  auto tick_start = std::chrono::steady_clock::now();
+
+  // NOTE: done before handling packets so that mouse updates are only routed to
+  // clients that are still connected
+  for (unsigned int client_id : synchronize_client_sessions(
+           client_sessions, transport.get_connected_client_ids(),
+           settings.max_rewind_ticks)) {
+    global_logger.info("client {} connected, started a session for it",
+                       client_id);
+  }
+
+  for (ReceivedPacket &received :
+       transport.get_received_packets_since_last_tick()) {
+    double wait_seconds =
+        std::chrono::duration<double>(tick_start - received.received_at)
+            .count();
+    statistics.packets_received++;
+    statistics.packet_wait_seconds_total += wait_seconds;
+    statistics.packet_wait_seconds_max =
+        std::max(statistics.packet_wait_seconds_max, wait_seconds);
+    std::vector<PacketWithSize> pws;
+    pws.push_back(std::move(received.packet));
+    sender_client_id_of_packet_being_handled = received.sender_client_id;
+    packet_handler.handle_packets(pws);
+  }
+  sender_client_id_of_packet_being_handled.reset();
+
+  auto new_pos = sphere_orbiter.process(dt);
+  physics_target->SetPosition(g2j(new_pos));
+  // NOTE: nothing integrates this, it's recorded in the snapshots and sent to
+  // clients so both can interpolate along the orbit
+  physics_target->SetLinearVelocity(g2j(sphere_orbiter.get_velocity()));
+
+  // NOTE: recorded after processing so that the history has the orbit the
+  // target is on this tick, a hit changes it for the next one
+  sphere_orbiter_history.record(update_number, sphere_orbiter,
+                                static_cast<float>(dt));
+  current_target_snapshot =
+      take_entity_snapshot(*physics_target, entity_shape_registry);
+
+  std::vector<ClientSession *> sessions;
+  for (auto &[client_id, session] : client_sessions) {
+    CameraReconstructionData &crd =
+        session.update_number_to_camera_reconstruction_data.record(
+            update_number);
+    crd = get_camera_reconstruction_data(session.fps_camera);
+    crd.last_processed_mouse_pos_update_number =
+        session.last_processed_mouse_pos_update_number;
+    sessions.push_back(&session);
+  }
+
+  global_logger.start_section("replaying mouse updates since last tick");
+  worker_pool.parallel_for(sessions.size(), [&](size_t i) {
+    replay_mouse_updates(*sessions[i]);
+  });
+  global_logger.end_section("replaying mouse updates since last tick");
+
+  // NOTE: sessions are resolved in client id order so that when two clients hit
+  // the target on the same tick the outcome doesn't depend on packet arrival
+  // order
+  for (ClientSession *session : sessions) {
+    resolve_shots(*session);
+  }
+
+  auto target_pos = physics_target->GetPosition();
+  auto target_vel = physics_target->GetLinearVelocity();
+
+  for (auto &[client_id, session] : client_sessions) {
+    GameUpdate gu(client_id, session.last_processed_mouse_pos_update_number,
+                  update_number, session.fps_camera.transform.get_rotation().y,
+                  session.fps_camera.transform.get_rotation().x,
+                  target_pos.GetX(), target_pos.GetY(), target_pos.GetZ(),
+                  target_vel.GetX(), target_vel.GetY(), target_vel.GetZ());
+    if (settings.send_game_frames) {
+      send_game_frame(session, gu);
+    } else {
+      send_game_update(session, gu);
+      send_sound_updates(session);
+    }
+  }
+  transport.flush();
+
+  update_number += 1;
+}
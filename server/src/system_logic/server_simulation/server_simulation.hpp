@@ -0,0 +1,168 @@
+#ifndef SERVER_SIMULATION_HPP
+#define SERVER_SIMULATION_HPP
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Physics/Character/CharacterVirtual.h>
+
+#include "../../meta_program/meta_program.hpp"
+#include "../../networking/packet_handler/packet_handler.hpp"
+#include "../../networking/packets/packets.hpp"
+#include "../../networking/transport/transport.hpp"
+#include "../../networking/wire_format/wire_format.hpp"
+#include "../../utility/worker_pool/worker_pool.hpp"
+#include "../client_session/client_session.hpp"
+#include "../entity_snapshot/entity_snapshot.hpp"
+#include "../physics/physics.hpp"
+#include "../orbiter_history/orbiter_history.hpp"
+#include "../sphere_orbiter/sphere_orbiter.hpp"
+
+struct ServerSimulationSettings {
+  // NOTE: when on game updates are sent bit packed, see wire_format for the
+  // precision that costs
+  bool send_quantized_packets = true;
+  // NOTE: when on game updates only carry the fields that changed since one the
+  // client acknowledged, this takes precedence over send_quantized_packets as
+  // delta game updates are always bit packed
+  bool send_delta_game_updates = true;
+  // NOTE: when on a client's game update and sound updates for a tick go out
+  // together as a single GAME_FRAME datagram instead of one datagram each
+  bool send_game_frames = true;
+  // NOTE: shots which reference a game update older than this many ticks are
+  // rejected instead of rewound, this is also how long game updates are kept
+  // around as delta baselines
+  unsigned int max_rewind_ticks = 60;
+  // NOTE: the threads that replay each client's inputs in parallel, the tick
+  // thread works alongside them
+  unsigned int worker_threads = 3;
+  bool subtick_firing_accuracy = true;
+  // NOTE: when off the target keeps its orbit no matter what, so that a run
+  // only depends on its inputs, a hit normally sends it off on a random one
+  bool move_target_on_hit = true;
+};
+
+// NOTE: counted since the simulation started
+struct ServerSimulationStatistics {
+  uint64_t shots = 0;
+  uint64_t hits = 0;
+  // NOTE: shots that referenced game updates outside of the rewind window
+  uint64_t rejected_shots = 0;
+  // NOTE: time spent on the rewind and ray cast of the shots that weren't
+  // rejected, summed over the worker threads
+  double shot_reconstruction_seconds = 0;
+  // NOTE: how long packets sat between arriving and the start of the tick that
+  // handled them, only meaningful when the transport stamps packets as they
+  // arrive, see ThreadedServerTransport
+  uint64_t packets_received = 0;
+  double packet_wait_seconds_total = 0;
+  double packet_wait_seconds_max = 0;
+};
+
+// NOTE: the whole server minus the loop that drives it and the network it
+// talks over, one call to tick is one server tick. Keeping it apart from main
+// is what lets it run against an in memory transport on a virtual clock, see
+// the loopback benchmark.
+class ServerSimulation {
+public:
+  ServerSimulation(const ServerSimulationSettings &settings,
+                   ServerTransport &transport, meta_program::MetaProgram &mp);
+
+  ServerSimulation(const ServerSimulation &) = delete;
+  ServerSimulation &operator=(const ServerSimulation &) = delete;
+
+  void tick(double dt);
+
+  unsigned int get_update_number() const { return update_number; }
+  size_t get_client_count() const { return client_sessions.size(); }
+  const ServerSimulationStatistics &get_statistics() const {
+    return statistics;
+  }
+  const JPH::Shape &get_target_shape() const {
+    return *physics_target->GetShape();
+  }
+
+private:
+  void register_packet_handlers();
+
+  // NOTE: the session of the client that sent the packet being handled as the
+  // transport saw it, the client id the packet claims to be from is only
+  // logged, packets the transport can't attribute find no session, see
+  // ReceivedPacket
+  ClientSessions::iterator find_sender_session(unsigned int claimed_client_id);
+
+  // NOTE: runs on the worker pool, once per session, it replays the session's
+  // inputs on its camera and for each shot works out where the target was from
+  // the history and whether the shot hit it there, it only reads the shared
+  // world (nothing registers shapes while this runs) and only writes the
+  // session, which is what makes it safe to run for every client at once. This
+  // is also why it doesn't log, the shots are logged when they're resolved.
+  void replay_mouse_updates(ClientSession &session);
+
+  // NOTE: feeds the camera the mouse updates strictly between the two numbers
+  // in order, skipping any that never arrived, when the client sends every
+  // mouse sample this walks the exact path it took, which matters because the
+  // pitch is clamped and the sensitivity can change along the way
+  void replay_mouse_path(ClientSession &session,
+                         unsigned int after_mouse_pos_update_number,
+                         unsigned int before_mouse_pos_update_number);
+
+  // NOTE: runs serially after every session has been replayed, this is the
+  // only place shots affect the world (the orbiter), sessions are visited in
+  // client id order and shots in the order they were fired so the outcome
+  // doesn't depend on how the jobs were scheduled.
+  void resolve_shots(ClientSession &session);
+
+  // NOTE: the target as it was update_number (which may be fractional) ticks
+  // in, dead reckoned extrapolation seconds past that when it isn't zero,
+  // returns false if that's outside of the rewind window
+  bool rewind_target(double update_number, double extrapolation,
+                     EntitySnapshot &snapshot) const;
+
+  // NOTE: writes gu in whichever encoding the settings ask for and records it
+  // as sent, the write functions append a complete packet to writer so they
+  // serve both the game frame and the one datagram per packet paths
+  void write_game_update(ClientSession &session, const GameUpdate &gu,
+                         wire_format::ByteWriter &writer);
+  void write_sound_update(const SoundUpdate &su,
+                          wire_format::ByteWriter &writer);
+
+  void send_game_frame(ClientSession &session, const GameUpdate &gu);
+  void send_game_update(ClientSession &session, const GameUpdate &gu);
+  void send_sound_updates(ClientSession &session);
+
+  ServerSimulationSettings settings;
+  ServerTransport &transport;
+  meta_program::MetaProgram &mp;
+
+  unsigned int update_number = 0;
+  Physics physics;
+  float room_size = 16.0f;
+  SphereOrbiter sphere_orbiter;
+  JPH::Ref<JPH::CharacterVirtual> physics_target;
+
+  WorkerPool worker_pool;
+  PacketHandler packet_handler;
+  // NOTE: packets are handed to the packet handler one at a time so that the
+  // handlers can tell who sent them
+  std::optional<unsigned int> sender_client_id_of_packet_being_handled;
+  ClientSessions client_sessions;
+
+  // NOTE: the target's history is shared by every client, each session keeps
+  // the camera history that goes with it. Only the orbit changes are kept, the
+  // rest of the target (its rotation and shape) is taken from how it is this
+  // tick as nothing changes those.
+  EntityShapeRegistry entity_shape_registry;
+  OrbiterHistory sphere_orbiter_history;
+  EntitySnapshot current_target_snapshot;
+
+  // NOTE: reused for every game frame so that sending them doesn't allocate
+  // once it has grown to fit
+  std::vector<uint8_t> game_frame;
+
+  ServerSimulationStatistics statistics;
+};
+
+#endif // SERVER_SIMULATION_HPP
@@ -3,6 +3,7 @@
 
 #include <cmath>
 #include <glm/glm.hpp>
+#include <glm/gtc/constants.hpp>
 #include <glm/gtx/rotate_vector.hpp>
 
 class SphereOrbiter {
@@ -19,11 +20,42 @@ public:
     set_travel_axis(travel_axis);
   }
 
-  // Advance the orbit and return the new position
+  // Advance the orbit and return the new position, the angle is kept within a
+  // turn so that it doesn't lose precision the longer it runs
   glm::vec3 process(float dt) {
-    angle += angular_speed * dt;
-    glm::vec3 rotated = glm::rotate(orbit_vector, angle, travel_axis);
-    return center + rotated;
+    angle = std::fmod(angle + angular_speed * dt, glm::two_pi<float>());
+    return get_position_at_angle(angle);
+  }
+
+  // Velocity at the current angle, the derivative of the position process
+  // returns
+  glm::vec3 get_velocity() const { return get_velocity_at_angle(angle); }
+
+  // The orbit is closed form in the angle, so any point on it can be found
+  // without stepping there, this is what rewinding the orbiter relies on
+  glm::vec3 get_position_at_angle(float angle) const {
+    return center + glm::rotate(orbit_vector, angle, travel_axis);
+  }
+
+  // Rotating about a unit axis k moves a point with velocity k x p
+  glm::vec3 get_velocity_at_angle(float angle) const {
+    glm::vec3 axis = glm::normalize(travel_axis);
+    glm::vec3 rotated = glm::rotate(orbit_vector, angle, axis);
+    return angular_speed * glm::cross(axis, rotated);
+  }
+
+  const glm::vec3 &get_center() const { return center; }
+  const glm::vec3 &get_travel_axis() const { return travel_axis; }
+  const glm::vec3 &get_orbit_vector() const { return orbit_vector; }
+  float get_angle() const { return angle; }
+  float get_angular_speed() const { return angular_speed; }
+
+  // True when both follow the same orbit at the same speed, only the angle
+  // along it may differ
+  bool has_same_motion(const SphereOrbiter &other) const {
+    return center == other.center and travel_axis == other.travel_axis and
+           orbit_vector == other.orbit_vector and
+           angular_speed == other.angular_speed;
   }
 
   void set_travel_axis(const glm::vec3 &travel_axis) {
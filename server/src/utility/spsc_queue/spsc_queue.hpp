@@ -0,0 +1,73 @@
+#ifndef SPSC_QUEUE_HPP
+#define SPSC_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+// NOTE: a bounded lock free queue for handing values from exactly one producer
+// thread to exactly one consumer thread, the capacity is rounded up to a power
+// of two. Each side keeps a copy of the other side's index and only reloads it
+// when the queue looks full (or empty), so in the common case a push or pop
+// touches no cache line the other thread is writing to.
+template <typename T> class SpscQueue {
+public:
+  explicit SpscQueue(size_t capacity)
+      : slots(round_up_to_power_of_two(capacity)), mask(slots.size() - 1) {}
+
+  SpscQueue(const SpscQueue &) = delete;
+  SpscQueue &operator=(const SpscQueue &) = delete;
+
+  // NOTE: producer only, returns false and leaves value alone when full
+  bool try_push(T &&value) {
+    size_t head = head_index.load(std::memory_order_relaxed);
+    if (head - cached_tail_index >= slots.size()) {
+      cached_tail_index = tail_index.load(std::memory_order_acquire);
+      if (head - cached_tail_index >= slots.size()) {
+        return false;
+      }
+    }
+    slots[head & mask] = std::move(value);
+    head_index.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // NOTE: consumer only, returns false when empty
+  bool try_pop(T &value) {
+    size_t tail = tail_index.load(std::memory_order_relaxed);
+    if (tail == cached_head_index) {
+      cached_head_index = head_index.load(std::memory_order_acquire);
+      if (tail == cached_head_index) {
+        return false;
+      }
+    }
+    value = std::move(slots[tail & mask]);
+    tail_index.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  size_t get_capacity() const { return slots.size(); }
+
+private:
+  static size_t round_up_to_power_of_two(size_t value) {
+    size_t power = 1;
+    while (power < value) {
+      power <<= 1;
+    }
+    return power;
+  }
+
+  std::vector<T> slots;
+  size_t mask;
+
+  // NOTE: written by the producer, the 64 keeps the two sides on separate
+  // cache lines
+  alignas(64) std::atomic<size_t> head_index{0};
+  size_t cached_tail_index = 0;
+
+  // NOTE: written by the consumer
+  alignas(64) std::atomic<size_t> tail_index{0};
+  size_t cached_head_index = 0;
+};
+
+#endif // SPSC_QUEUE_HPP
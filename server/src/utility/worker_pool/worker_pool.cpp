@@ -0,0 +1,82 @@
+#include "worker_pool.hpp"
+
+WorkerPool::WorkerPool(unsigned int worker_count) {
+  for (unsigned int i = 0; i < worker_count; i++) {
+    workers.emplace_back([this] { worker_loop(); });
+  }
+}
+
+WorkerPool::~WorkerPool() {
+  {
+    std::lock_guard lock(mutex);
+    stopping = true;
+  }
+  batch_started.notify_all();
+  for (std::thread &worker : workers) {
+    worker.join();
+  }
+}
+
+void WorkerPool::parallel_for(size_t job_count,
+                              const std::function<void(size_t)> &job) {
+  if (workers.empty() or job_count <= 1) {
+    for (size_t i = 0; i < job_count; i++) {
+      job(i);
+    }
+    return;
+  }
+
+  {
+    std::lock_guard lock(mutex);
+    current_job = &job;
+    current_job_count = job_count;
+    next_job_index = 0;
+    workers_still_running = static_cast<unsigned int>(workers.size());
+    batch_number++;
+  }
+  batch_started.notify_all();
+
+  run_jobs(job, job_count);
+
+  std::unique_lock lock(mutex);
+  batch_finished.wait(lock, [this] { return workers_still_running == 0; });
+  current_job = nullptr;
+}
+
+void WorkerPool::worker_loop() {
+  uint64_t last_batch_number = 0;
+  while (true) {
+    const std::function<void(size_t)> *job;
+    size_t job_count;
+    {
+      std::unique_lock lock(mutex);
+      batch_started.wait(lock, [&] {
+        return stopping or batch_number != last_batch_number;
+      });
+      if (stopping) {
+        return;
+      }
+      last_batch_number = batch_number;
+      job = current_job;
+      job_count = current_job_count;
+    }
+
+    run_jobs(*job, job_count);
+
+    {
+      std::lock_guard lock(mutex);
+      workers_still_running--;
+    }
+    batch_finished.notify_one();
+  }
+}
+
+void WorkerPool::run_jobs(const std::function<void(size_t)> &job,
+                          size_t job_count) {
+  // NOTE: jobs are handed out one at a time so that a few slow clients don't
+  // leave the other threads idle
+  for (size_t i = next_job_index.fetch_add(1); i < job_count;
+       i = next_job_index.fetch_add(1)) {
+    job(i);
+  }
+}
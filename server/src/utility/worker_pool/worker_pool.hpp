@@ -0,0 +1,51 @@
+#ifndef WORKER_POOL_HPP
+#define WORKER_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// NOTE: a fixed set of threads that run one batch of jobs at a time, the thread
+// calling parallel_for works through the batch as well and only returns once
+// every job is done, so anything the jobs wrote is visible to it afterwards.
+// With zero workers everything simply runs on the calling thread.
+class WorkerPool {
+public:
+  explicit WorkerPool(unsigned int worker_count);
+  ~WorkerPool();
+
+  WorkerPool(const WorkerPool &) = delete;
+  WorkerPool &operator=(const WorkerPool &) = delete;
+
+  // NOTE: calls job(i) for every i in [0, job_count) in no particular order and
+  // possibly concurrently, jobs must not touch each others data
+  void parallel_for(size_t job_count, const std::function<void(size_t)> &job);
+
+  unsigned int get_worker_count() const {
+    return static_cast<unsigned int>(workers.size());
+  }
+
+private:
+  void worker_loop();
+  void run_jobs(const std::function<void(size_t)> &job, size_t job_count);
+
+  std::vector<std::thread> workers;
+
+  std::mutex mutex;
+  std::condition_variable batch_started;
+  std::condition_variable batch_finished;
+
+  const std::function<void(size_t)> *current_job = nullptr;
+  size_t current_job_count = 0;
+  std::atomic<size_t> next_job_index = 0;
+  unsigned int workers_still_running = 0;
+  uint64_t batch_number = 0;
+  bool stopping = false;
+};
+
+#endif // WORKER_POOL_HPP
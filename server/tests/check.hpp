@@ -0,0 +1,28 @@
+#ifndef CHECK_HPP
+#define CHECK_HPP
+
+#include <iostream>
+#include <string>
+
+// NOTE: the tests call check for everything they verify and return report_checks() from main, which ctest sees as a
+// failure when any check failed
+
+inline int failed_checks = 0;
+
+inline void check(bool condition, const std::string &description) {
+    if (not condition) {
+        std::cout << "FAILED: " << description << std::endl;
+        failed_checks++;
+    }
+}
+
+inline int report_checks() {
+    if (failed_checks > 0) {
+        std::cout << failed_checks << " checks failed" << std::endl;
+        return 1;
+    }
+    std::cout << "all checks passed" << std::endl;
+    return 0;
+}
+
+#endif // CHECK_HPP
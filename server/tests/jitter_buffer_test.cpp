@@ -0,0 +1,26 @@
+#include "../src/system_logic/jitter_buffer/jitter_buffer.hpp"
+#include "check.hpp"
+
+// NOTE: checks that an update which arrives after one more than the buffer's capacity newer than it is rejected
+// instead of taking the newer one's slot, update_number % (capacity + 1) is the same for both in these checks.
+//
+// usage: jitter_buffer_test
+
+int main() {
+    const unsigned int capacity = 128;
+    const unsigned int newest = 1000;
+    const unsigned int stale = newest - (capacity + 1);
+
+    JitterBuffer<unsigned int>::Settings settings;
+    JitterBuffer<unsigned int> jitter_buffer(settings, capacity);
+    check(jitter_buffer.insert(newest, newest, 0), "the newest update is inserted");
+    check(not jitter_buffer.insert(stale, stale, 0.1), "an update older than newest - capacity is rejected");
+    check(jitter_buffer.get_statistics().late == 1, "the rejected update is counted as late");
+    // NOTE: the newest update is only reported as a duplicate if it is still in its slot
+    check(not jitter_buffer.insert(newest, newest, 0.2) and jitter_buffer.get_statistics().duplicates == 1,
+          "the newest update is still there after the old one arrived");
+    check(jitter_buffer.insert(newest - capacity, newest - capacity, 0.3),
+          "an update exactly capacity behind the newest is still kept");
+
+    return report_checks();
+}
@@ -0,0 +1,23 @@
+#include "../src/system_logic/rewind_history/rewind_history.hpp"
+#include "check.hpp"
+
+// NOTE: checks which update numbers RewindHistory considers too old to record, recording one of them would take the
+// slot of a newer one since update_number % (max_rewind_ticks + 1) is the same for both.
+//
+// usage: rewind_history_test
+
+int main() {
+    const unsigned int max_rewind_ticks = 128;
+    const unsigned int newest = 1000;
+
+    RewindHistory<unsigned int> history(max_rewind_ticks);
+    history.record(newest) = newest;
+    check(history.is_older_than_rewind_window(newest - (max_rewind_ticks + 1)),
+          "an update which shares the newest one's slot is too old to record");
+    check(not history.is_older_than_rewind_window(newest - max_rewind_ticks),
+          "the oldest update in the window can still be recorded");
+    check(not history.is_older_than_rewind_window(newest), "the newest update can be recorded again");
+    check(not history.is_older_than_rewind_window(newest + 1), "newer updates can always be recorded");
+
+    return report_checks();
+}
@@ -0,0 +1,67 @@
+#include <vector>
+
+#include "../src/networking/packets/packets.hpp"
+#include "../src/networking/wire_format/wire_format.hpp"
+#include "check.hpp"
+
+// NOTE: checks that game update numbers survive the quantized and delta encodings, in particular for a client that joins a server
+// which has been running for longer than the low bits of an update number can cover.
+//
+// usage: wire_format_test
+
+GameUpdate make_game_update(unsigned int update_number) {
+    GameUpdate game_update{};
+    game_update.client_id = 7;
+    game_update.last_processed_mouse_pos_update_number = 12;
+    game_update.update_number = update_number;
+    return game_update;
+}
+
+bool round_trip_quantized(const GameUpdate &game_update, bool send_full_update_number,
+                          unsigned int update_number_reference, GameUpdate &decoded) {
+    std::vector<uint8_t> buffer;
+    wire_format::ByteWriter writer(buffer);
+    wire_format::serialize_quantized(game_update, send_full_update_number, writer);
+    wire_format::ByteReader reader(buffer);
+    return wire_format::deserialize_quantized(reader, decoded, update_number_reference, 12);
+}
+
+bool round_trip_delta(const GameUpdate &game_update, const GameUpdate *baseline, unsigned int update_number_reference,
+                      GameUpdate &decoded) {
+    std::vector<uint8_t> buffer;
+    wire_format::ByteWriter writer(buffer);
+    wire_format::serialize_delta(game_update, baseline, writer);
+    wire_format::ByteReader reader(buffer);
+    return wire_format::deserialize_delta(reader, decoded, update_number_reference, 12,
+                                          [&](unsigned int update_number) -> const GameUpdate * {
+                                              bool is_baseline = baseline != nullptr and
+                                                                 baseline->update_number == update_number;
+                                              return is_baseline ? baseline : nullptr;
+                                          });
+}
+
+int main() {
+    GameUpdate decoded;
+
+    // NOTE: a client that just joined has nothing but 0 to reconstruct against, which the low bits alone get wrong
+    check(wire_format::reconstruct_sequence_number(40000 & 0xffff, 0) != 40000,
+          "the low bits of 40000 are ambiguous from reference 0");
+    check(round_trip_quantized(make_game_update(40000), true, 0, decoded) and decoded.update_number == 40000,
+          "update number 40000 decodes from reference 0 when sent in full");
+
+    // NOTE: once acknowledged only the low bits are sent and the client's last update number is close enough
+    check(round_trip_quantized(make_game_update(40001), false, 40000, decoded) and decoded.update_number == 40001,
+          "update number 40001 decodes from reference 40000 when sent as its low bits");
+    check(round_trip_quantized(make_game_update(65536 + 3), false, 65535, decoded) and
+              decoded.update_number == 65536 + 3,
+          "the low bits wrap around past 2^16");
+
+    // NOTE: a delta game update without a baseline is what a client that just joined gets first
+    check(round_trip_delta(make_game_update(40000), nullptr, 0, decoded) and decoded.update_number == 40000,
+          "update number 40000 decodes from reference 0 in a delta without a baseline");
+    GameUpdate baseline = make_game_update(40000);
+    check(round_trip_delta(make_game_update(40002), &baseline, 40000, decoded) and decoded.update_number == 40002,
+          "update number 40002 decodes from reference 40000 in a delta against 40000");
+
+    return report_checks();
+}
@@ -0,0 +1,307 @@
+#include "bot_session.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numbers>
+#include <span>
+
+#include "../../networking/wire_format/wire_format.hpp"
+#include "../../utility/logger/logger.hpp"
+
+MousePath mouse_path_from_string(const std::string &mouse_path) {
+  if (mouse_path == "sweep") {
+    return MousePath::SWEEP;
+  }
+  if (mouse_path == "random_walk") {
+    return MousePath::RANDOM_WALK;
+  }
+  return MousePath::CIRCLE;
+}
+
+BotStatistics &BotStatistics::operator+=(const BotStatistics &other) {
+  packets_sent += other.packets_sent;
+  bytes_sent += other.bytes_sent;
+  packets_received += other.packets_received;
+  bytes_received += other.bytes_received;
+  game_updates_received += other.game_updates_received;
+  game_update_decode_failures += other.game_update_decode_failures;
+  game_updates_skipped += other.game_updates_skipped;
+  shots_fired += other.shots_fired;
+  hits += other.hits;
+  misses += other.misses;
+  input_latency_total += other.input_latency_total;
+  input_latency_max = std::max(input_latency_max, other.input_latency_max);
+  input_latency_samples += other.input_latency_samples;
+  return *this;
+}
+
+BotSession::BotSession(unsigned int bot_index, const BotBehaviour &behaviour,
+                       ClientTransport &transport,
+                       meta_program::MetaProgram &mp)
+    : bot_index(bot_index), behaviour(behaviour), mp(mp), transport(transport),
+      random_engine(bot_index), update_number_to_received_game_update(128),
+      mouse_pos_update_number_to_send_time(128) {
+  // NOTE: spread the bots out so they don't all move and fire in lock step
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+  random_walk_heading = 2 * std::numbers::pi * unit(random_engine);
+  mouse_path_time_offset = 10 * unit(random_engine);
+  if (behaviour.fire_rate > 0) {
+    time_until_next_shot = unit(random_engine) / behaviour.fire_rate;
+  }
+
+  register_packet_handlers();
+}
+
+void BotSession::register_packet_handlers() {
+  packet_handler.register_handler(
+      PacketType::GAME_UPDATE, [this](std::vector<uint8_t> raw_packet) {
+        GameUpdatePacket packet;
+        if (not wire_format::deserialize(std::span<const uint8_t>(raw_packet),
+                                         packet)) {
+          statistics.game_update_decode_failures++;
+          return;
+        }
+        apply_game_update(packet.game_update);
+      });
+
+  packet_handler.register_handler(
+      PacketType::GAME_UPDATE_QUANTIZED,
+      [this](std::vector<uint8_t> raw_packet) {
+        GameUpdate game_update;
+        wire_format::ByteReader reader(raw_packet);
+        if (not wire_format::deserialize_quantized(
+                reader, game_update, last_received_game_update_number,
+                mouse_pos_update_number)) {
+          statistics.game_update_decode_failures++;
+          return;
+        }
+        apply_game_update(game_update);
+      });
+
+  packet_handler.register_handler(
+      PacketType::GAME_UPDATE_DELTA, [this](std::vector<uint8_t> raw_packet) {
+        GameUpdate game_update;
+        wire_format::ByteReader reader(raw_packet);
+        auto get_baseline =
+            [this](unsigned int baseline_update_number) -> const GameUpdate * {
+          return update_number_to_received_game_update.get(
+              baseline_update_number);
+        };
+        if (not wire_format::deserialize_delta(
+                reader, game_update, last_received_game_update_number,
+                mouse_pos_update_number, get_baseline)) {
+          statistics.game_update_decode_failures++;
+          return;
+        }
+        apply_game_update(game_update);
+      });
+
+  packet_handler.register_handler(
+      PacketType::SOUND_UPDATE, [this](std::vector<uint8_t> raw_packet) {
+        SoundUpdatePacket packet;
+        if (not wire_format::deserialize(std::span<const uint8_t>(raw_packet),
+                                         packet)) {
+          return;
+        }
+        if (packet.sound_update.sound_to_play == SoundType::SERVER_HIT) {
+          statistics.hits++;
+        } else if (packet.sound_update.sound_to_play ==
+                   SoundType::SERVER_MISS) {
+          statistics.misses++;
+        }
+      });
+
+  // NOTE: the packets in a frame go through the handlers above in the order
+  // the server wrote them, game update first
+  packet_handler.register_handler(
+      PacketType::GAME_FRAME, [this](std::vector<uint8_t> raw_packet) {
+        std::vector<PacketWithSize> packets_in_frame;
+        if (not wire_format::split_game_frame(raw_packet, packets_in_frame)) {
+          statistics.game_update_decode_failures++;
+          return;
+        }
+        packet_handler.handle_packets(packets_in_frame);
+      });
+}
+
+void BotSession::apply_game_update(const GameUpdate &game_update) {
+  statistics.game_updates_received++;
+  global_logger.debug("bot {} received game update: {}", bot_index,
+                      mp.GameUpdate_to_string(game_update));
+
+  // NOTE: a reordered game update from before the history's window would take
+  // a newer one's slot
+  if (not update_number_to_received_game_update.is_older_than_rewind_window(
+          game_update.update_number)) {
+    update_number_to_received_game_update.record(game_update.update_number) =
+        game_update;
+  }
+  if (not received_a_game_update or
+      game_update.update_number > last_received_game_update_number) {
+    if (received_a_game_update) {
+      statistics.game_updates_skipped +=
+          game_update.update_number - last_received_game_update_number - 1;
+    }
+    received_a_game_update = true;
+    last_received_game_update_number = game_update.update_number;
+  }
+  client_id = game_update.client_id;
+  std::erase_if(unacknowledged_mouse_updates, [&](const MouseUpdate &mu) {
+    return mu.mouse_pos_update_number <=
+           game_update.last_processed_mouse_pos_update_number;
+  });
+
+  // NOTE: the first game update to include a mouse update closes its round
+  // trip, later ones acknowledging the same number are not counted again
+  unsigned int processed = game_update.last_processed_mouse_pos_update_number;
+  if (measured_an_input_latency and
+      processed <= last_measured_mouse_pos_update_number) {
+    return;
+  }
+  const double *send_time = mouse_pos_update_number_to_send_time.get(processed);
+  if (send_time == nullptr) {
+    return;
+  }
+  double input_latency = elapsed_time - *send_time;
+  statistics.input_latency_total += input_latency;
+  statistics.input_latency_max =
+      std::max(statistics.input_latency_max, input_latency);
+  statistics.input_latency_samples++;
+  measured_an_input_latency = true;
+  last_measured_mouse_pos_update_number = processed;
+}
+
+void BotSession::tick(double dt) {
+  std::vector<PacketWithSize> pws =
+      transport.get_network_events_received_since_last_tick();
+  for (const PacketWithSize &packet : pws) {
+    statistics.packets_received++;
+    statistics.bytes_received += packet.size;
+  }
+  elapsed_time += dt;
+  packet_handler.handle_packets(pws);
+
+  move_mouse(dt);
+  bool fire_pressed = should_fire(dt);
+
+  // NOTE: like the real client we can't send anything the server could
+  // attribute to us until a game update has told us our id
+  if (received_a_game_update) {
+    send_mouse_update(fire_pressed);
+  }
+}
+
+void BotSession::move_mouse(double dt) {
+  previous_mouse_x = mouse_x;
+  previous_mouse_y = mouse_y;
+
+  double mouse_path_time = mouse_path_time_offset + elapsed_time;
+  switch (behaviour.mouse_path) {
+  case MousePath::CIRCLE: {
+    double radius = 200;
+    double angle = behaviour.mouse_speed / radius * mouse_path_time;
+    mouse_x = radius * std::cos(angle);
+    mouse_y = radius * std::sin(angle);
+    break;
+  }
+  case MousePath::SWEEP: {
+    // NOTE: a triangle wave between -half_width and half_width
+    double half_width = 400;
+    double period = 4 * half_width / behaviour.mouse_speed;
+    double phase = std::fmod(mouse_path_time, period) / period;
+    mouse_x = half_width * (phase < 0.5 ? 4 * phase - 1 : 3 - 4 * phase);
+    mouse_y = 0;
+    break;
+  }
+  case MousePath::RANDOM_WALK: {
+    std::normal_distribution<double> heading_change(0.0, 2 * std::sqrt(dt));
+    random_walk_heading += heading_change(random_engine);
+    mouse_x += std::cos(random_walk_heading) * behaviour.mouse_speed * dt;
+    mouse_y += std::sin(random_walk_heading) * behaviour.mouse_speed * dt;
+    break;
+  }
+  }
+
+  mouse_pos_update_number++;
+}
+
+bool BotSession::should_fire(double dt) {
+  if (behaviour.fire_rate <= 0 or not received_a_game_update) {
+    return false;
+  }
+  time_until_next_shot -= dt;
+  // NOTE: the server fires on the rising edge of fire_pressed, so a shot is
+  // held back a send if the previous one had it set
+  if (time_until_next_shot > 0 or fire_pressed_last_send) {
+    return false;
+  }
+  time_until_next_shot += 1 / behaviour.fire_rate;
+  return true;
+}
+
+void BotSession::send_mouse_update(bool fire_pressed) {
+  // NOTE: pretend the click happened somewhere between the last two cursor
+  // positions, which exercises the server's subtick reconstruction
+  double subtick_percentage = 0;
+  double subtick_x_pos_before_firing = 0;
+  double subtick_y_pos_before_firing = 0;
+  if (fire_pressed) {
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    subtick_percentage = unit(random_engine);
+    subtick_x_pos_before_firing =
+        previous_mouse_x + subtick_percentage * (mouse_x - previous_mouse_x);
+    subtick_y_pos_before_firing =
+        previous_mouse_y + subtick_percentage * (mouse_y - previous_mouse_y);
+    statistics.shots_fired++;
+  }
+
+  // NOTE: a bot doesn't draw the target, so it never extrapolates it
+  MouseUpdate mu(client_id, mouse_pos_update_number, received_a_game_update,
+                 last_received_game_update_number,
+                 last_received_game_update_number,
+                 last_received_game_update_number, subtick_percentage, 0,
+                 subtick_x_pos_before_firing, subtick_y_pos_before_firing,
+                 mouse_x, mouse_y, fire_pressed, behaviour.sensitivity);
+  fire_pressed_last_send = fire_pressed;
+
+  unacknowledged_mouse_updates.push_back(mu);
+  if (unacknowledged_mouse_updates.size() >
+      behaviour.mouse_update_window_size) {
+    unacknowledged_mouse_updates.erase(unacknowledged_mouse_updates.begin());
+  }
+
+  size_t bytes_written;
+  if (behaviour.mouse_update_window_size > 1) {
+    std::array<uint8_t, wire_format::max_size_when_mouse_update_window> buffer;
+    wire_format::ByteWriter writer(buffer);
+    wire_format::serialize_mouse_update_window(unacknowledged_mouse_updates,
+                                               writer);
+    bytes_written = writer.get_bytes_written();
+    transport.send_packet(buffer.data(), bytes_written);
+  } else if (behaviour.send_quantized_packets) {
+    std::array<uint8_t, wire_format::max_size_when_quantized_mouse_update>
+        buffer;
+    wire_format::ByteWriter writer(buffer);
+    wire_format::serialize_quantized(mu, writer);
+    bytes_written = writer.get_bytes_written();
+    transport.send_packet(buffer.data(), bytes_written);
+  } else {
+    MouseUpdatePacket mup;
+    mup.header.type = PacketType::MOUSE_UPDATE;
+    mup.header.size_of_data_without_header =
+        wire_format::size_when_serialized<MouseUpdate>;
+    mup.mouse_update = mu;
+
+    wire_format::FixedSizeBuffer<MouseUpdatePacket> buffer;
+    wire_format::ByteWriter writer(buffer);
+    wire_format::serialize(mup, writer);
+    bytes_written = buffer.size();
+    transport.send_packet(buffer.data(), bytes_written);
+  }
+
+  statistics.packets_sent++;
+  statistics.bytes_sent += bytes_written;
+  mouse_pos_update_number_to_send_time.record(mouse_pos_update_number) =
+      elapsed_time;
+}
@@ -0,0 +1,132 @@
+#ifndef BOT_SESSION_HPP
+#define BOT_SESSION_HPP
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../../meta_program/meta_program.hpp"
+#include "../../networking/packet_handler/packet_handler.hpp"
+#include "../../networking/packets/packets.hpp"
+#include "../../networking/transport/transport.hpp"
+#include "../rewind_history/rewind_history.hpp"
+
+enum class MousePath {
+  // NOTE: constant speed around a circle, the camera keeps turning one way
+  CIRCLE,
+  // NOTE: back and forth along the x axis, like scanning a corridor
+  SWEEP,
+  // NOTE: constant speed with a heading that drifts randomly
+  RANDOM_WALK,
+};
+
+// NOTE: returns CIRCLE for anything it doesn't recognize
+MousePath mouse_path_from_string(const std::string &mouse_path);
+
+struct BotBehaviour {
+  MousePath mouse_path = MousePath::CIRCLE;
+  // NOTE: in pixels per second
+  double mouse_speed = 600;
+  // NOTE: in shots per second, zero never fires
+  double fire_rate = 2;
+  double sensitivity = 1;
+  bool send_quantized_packets = true;
+  // NOTE: when above one mouse updates are sent as a MOUSE_UPDATE_WINDOW
+  // holding up to this many of the ones the server hasn't acknowledged yet
+  size_t mouse_update_window_size = 8;
+};
+
+struct BotStatistics {
+  uint64_t packets_sent = 0;
+  uint64_t bytes_sent = 0;
+  uint64_t packets_received = 0;
+  uint64_t bytes_received = 0;
+  uint64_t game_updates_received = 0;
+  // NOTE: game updates that arrived but couldn't be decoded, because they were
+  // cut short or their delta baseline was no longer around
+  uint64_t game_update_decode_failures = 0;
+  // NOTE: update numbers jumped over by a newer game update, the server sends
+  // one every tick so these were lost or are late, late ones stay counted
+  uint64_t game_updates_skipped = 0;
+  uint64_t shots_fired = 0;
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+  // NOTE: from sending a mouse update to receiving the first game update that
+  // says it was processed, in seconds of the time passed to tick
+  double input_latency_total = 0;
+  double input_latency_max = 0;
+  uint64_t input_latency_samples = 0;
+
+  BotStatistics &operator+=(const BotStatistics &other);
+};
+
+// NOTE: a headless stand in for the real client, it speaks the same protocol
+// (mouse updates out, game and sound updates in, including the quantized and
+// delta encodings) but instead of a window and a mouse it moves a synthetic
+// cursor and fires on a timer, there is no prediction or reconciliation as
+// nothing is rendered, the point is to load the server like a player would.
+// It talks through a ClientTransport so it can load a real server over enet or
+// a ServerSimulation over a loopback in the same process, the transport has to
+// outlive the bot.
+class BotSession {
+public:
+  BotSession(unsigned int bot_index, const BotBehaviour &behaviour,
+             ClientTransport &transport, meta_program::MetaProgram &mp);
+
+  BotSession(const BotSession &) = delete;
+  BotSession &operator=(const BotSession &) = delete;
+
+  // NOTE: handles whatever arrived since the last tick, moves the cursor and
+  // sends one mouse update
+  void tick(double dt);
+
+  bool has_received_game_update() const { return received_a_game_update; }
+  const BotStatistics &get_statistics() const { return statistics; }
+
+private:
+  void register_packet_handlers();
+  void apply_game_update(const GameUpdate &game_update);
+  void move_mouse(double dt);
+  bool should_fire(double dt);
+  void send_mouse_update(bool fire_pressed);
+
+  unsigned int bot_index;
+  BotBehaviour behaviour;
+  meta_program::MetaProgram &mp;
+
+  ClientTransport &transport;
+  PacketHandler packet_handler;
+
+  std::mt19937 random_engine;
+
+  double elapsed_time = 0;
+  // NOTE: where along the mouse path the bot started, so they don't all move
+  // in lock step
+  double mouse_path_time_offset = 0;
+  double mouse_x = 0;
+  double mouse_y = 0;
+  double previous_mouse_x = 0;
+  double previous_mouse_y = 0;
+  double random_walk_heading = 0;
+  unsigned int mouse_pos_update_number = 0;
+  // NOTE: oldest first, trimmed as game updates acknowledge them
+  std::vector<MouseUpdate> unacknowledged_mouse_updates;
+
+  double time_until_next_shot = 0;
+  bool fire_pressed_last_send = false;
+
+  // NOTE: the same bookkeeping the real client does, see MouseUpdate
+  unsigned int client_id = 0;
+  bool received_a_game_update = false;
+  unsigned int last_received_game_update_number = 0;
+  RewindHistory<GameUpdate> update_number_to_received_game_update;
+
+  RewindHistory<double> mouse_pos_update_number_to_send_time;
+  bool measured_an_input_latency = false;
+  unsigned int last_measured_mouse_pos_update_number = 0;
+
+  BotStatistics statistics;
+};
+
+#endif // BOT_SESSION_HPP
@@ -0,0 +1,40 @@
+#ifndef HERMITE_INTERPOLATION_HPP
+#define HERMITE_INTERPOLATION_HPP
+
+// NOTE: entities that move along curves (like the target on its orbit) cut
+// corners when their position is interpolated linearly between snapshots, a
+// cubic hermite spline through the two positions that also matches the
+// velocities at both ends follows the curve instead. Both ends have to use the
+// same interpolation so that the server rewinds to what the client drew.
+//
+// Vec can be anything with vector addition and scaling by a float, so glm::vec3
+// on the client and JPH::Vec3 on the server.
+
+// NOTE: t = 0 gives start_position, t = 1 gives end_position, duration is the
+// time in seconds between the two snapshots which the velocities are scaled by
+template <typename Vec>
+Vec hermite_interpolate(const Vec &start_position, const Vec &start_velocity,
+                        const Vec &end_position, const Vec &end_velocity,
+                        float duration, float t) {
+  float t2 = t * t;
+  float t3 = t2 * t;
+  float start_position_weight = 2 * t3 - 3 * t2 + 1;
+  float start_velocity_weight = t3 - 2 * t2 + t;
+  float end_position_weight = -2 * t3 + 3 * t2;
+  float end_velocity_weight = t3 - t2;
+  return start_position_weight * start_position +
+         (start_velocity_weight * duration) * start_velocity +
+         end_position_weight * end_position +
+         (end_velocity_weight * duration) * end_velocity;
+}
+
+// NOTE: dead reckoning for when there is no snapshot to interpolate towards,
+// the caller bounds elapsed so that an entity we stop hearing about doesn't fly
+// off, see JitterBuffer::Settings::max_extrapolation
+template <typename Vec>
+Vec extrapolate_position(const Vec &position, const Vec &velocity,
+                         float elapsed) {
+  return position + elapsed * velocity;
+}
+
+#endif // HERMITE_INTERPOLATION_HPP
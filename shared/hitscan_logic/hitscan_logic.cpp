@@ -1,14 +1,45 @@
 #include "hitscan_logic.hpp"
 
-bool run_hitscan_logic(FPSCamera &fps_camera,
-                       JPH::Ref<JPH::CharacterVirtual> physics_target) {
-  bool had_hit = false;
-  JPH::RayCastResult rcr;
+JPH::RayCast make_aim_ray(FPSCamera &fps_camera) {
   JPH::RayCast aim_ray;
   aim_ray.mOrigin = JPH::Vec3(0, 0, 0);
   aim_ray.mDirection = g2j(fps_camera.transform.compute_forward_vector()) * 100;
-  aim_ray.mOrigin -= physics_target->GetPosition();
-  had_hit = physics_target->GetShape()->CastRay(aim_ray,
-                                                JPH::SubShapeIDCreator(), rcr);
-  return had_hit;
+  return aim_ray;
+}
+
+bool run_hitscan_logic(const JPH::RayCast &aim_ray,
+                       JPH::Vec3Arg target_position,
+                       JPH::QuatArg target_rotation,
+                       const JPH::Shape &target_shape) {
+  float fraction = JPH::RayCastResult().mFraction;
+  return cast_ray_against_target(aim_ray, target_position, target_rotation,
+                                 target_shape, fraction);
+}
+
+bool cast_ray_against_target(const JPH::RayCast &aim_ray,
+                             JPH::Vec3Arg target_position,
+                             JPH::QuatArg target_rotation,
+                             const JPH::Shape &target_shape, float &fraction) {
+  // NOTE: shapes are cast against in their own local space, so instead of
+  // moving the shape to the pose we move the ray into the shape's space
+  JPH::Mat44 world_to_target =
+      JPH::Mat44::sRotationTranslation(target_rotation, target_position)
+          .InversedRotationTranslation();
+  JPH::RayCast local_aim_ray = aim_ray.Transformed(world_to_target);
+
+  JPH::RayCastResult rcr;
+  rcr.mFraction = fraction;
+  if (not target_shape.CastRay(local_aim_ray, JPH::SubShapeIDCreator(), rcr)) {
+    return false;
+  }
+  fraction = rcr.mFraction;
+  return true;
+}
+
+bool run_hitscan_logic(FPSCamera &fps_camera,
+                       JPH::Ref<JPH::CharacterVirtual> physics_target) {
+  return run_hitscan_logic(make_aim_ray(fps_camera),
+                           JPH::Vec3(physics_target->GetPosition()),
+                           physics_target->GetRotation(),
+                           *physics_target->GetShape());
 }
@@ -10,6 +10,28 @@
 #include "../../graphics/fps_camera/fps_camera.hpp"
 #include "../../utility/jolt_glm_type_conversions/jolt_glm_type_conversions.hpp"
 
+// NOTE: the ray shot from the camera along the direction it's looking, in world
+// space
+JPH::RayCast make_aim_ray(FPSCamera &fps_camera);
+
+// NOTE: casts the ray against a target shape placed at the given pose, the pose
+// can come from anywhere (for example a snapshot from a few game updates ago),
+// nothing is moved so any number of these can run at once as long as the shape
+// isn't being modified.
+bool run_hitscan_logic(const JPH::RayCast &aim_ray,
+                       JPH::Vec3Arg target_position,
+                       JPH::QuatArg target_rotation,
+                       const JPH::Shape &target_shape);
+
+// NOTE: like run_hitscan_logic but only hits closer along the ray than
+// fraction count, fraction is updated to where the target was hit when it was,
+// this is what lets the closest of many targets be found, see HitscanWorld
+bool cast_ray_against_target(const JPH::RayCast &aim_ray,
+                             JPH::Vec3Arg target_position,
+                             JPH::QuatArg target_rotation,
+                             const JPH::Shape &target_shape, float &fraction);
+
+// NOTE: hitscan against the target where it currently is
 bool run_hitscan_logic(FPSCamera &fps_camera,
                        JPH::Ref<JPH::CharacterVirtual> physics_target);
 
@@ -0,0 +1 @@
+#include "jitter_buffer.hpp"
@@ -0,0 +1,220 @@
+#include "network_sim.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+JitterDistribution jitter_distribution_from_string(const std::string &name) {
+  if (name == "uniform") {
+    return JitterDistribution::UNIFORM;
+  }
+  if (name == "exponential") {
+    return JitterDistribution::EXPONENTIAL;
+  }
+  return JitterDistribution::NORMAL;
+}
+
+NetworkSimSettings
+network_sim_settings_from_configuration(Configuration &configuration) {
+  auto get_double = [&](const std::string &key, double default_value) {
+    auto value = configuration.get_value("network_sim", key);
+    return value ? std::stod(*value) : default_value;
+  };
+
+  JitterDistribution jitter_distribution = jitter_distribution_from_string(
+      configuration.get_value("network_sim", "jitter_distribution")
+          .value_or("normal"));
+
+  auto read_link = [&](const std::string &prefix) {
+    LinkImpairment impairment;
+    impairment.latency = get_double(prefix + "latency_ms", 0) / 1000;
+    impairment.jitter = get_double(prefix + "jitter_ms", 0) / 1000;
+    impairment.jitter_distribution = jitter_distribution;
+    impairment.drop_rate = get_double(prefix + "drop_rate", 0);
+    impairment.duplicate_rate = get_double(prefix + "duplicate_rate", 0);
+    impairment.reorder_rate = get_double(prefix + "reorder_rate", 0);
+    impairment.reorder_delay =
+        get_double(prefix + "reorder_delay_ms", 20) / 1000;
+    return impairment;
+  };
+
+  NetworkSimSettings settings;
+  settings.enabled = configuration.get_value("network_sim", "enabled") == "on";
+  settings.up = read_link("up_");
+  settings.down = read_link("down_");
+  settings.seed = static_cast<unsigned int>(get_double("seed", 0));
+  return settings;
+}
+
+SimulationClock real_time_clock() {
+  auto start = std::chrono::steady_clock::now();
+  return [start]() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                         start)
+        .count();
+  };
+}
+
+ImpairedLink::ImpairedLink(const LinkImpairment &impairment, unsigned int seed)
+    : impairment(impairment), random_engine(seed) {}
+
+double ImpairedLink::sample_delay() {
+  double jitter = 0;
+  if (impairment.jitter > 0) {
+    switch (impairment.jitter_distribution) {
+    case JitterDistribution::UNIFORM:
+      jitter = std::uniform_real_distribution<double>(
+          -impairment.jitter, impairment.jitter)(random_engine);
+      break;
+    case JitterDistribution::NORMAL:
+      jitter = std::normal_distribution<double>(0.0, impairment.jitter)(
+          random_engine);
+      break;
+    case JitterDistribution::EXPONENTIAL:
+      jitter = std::exponential_distribution<double>(1 / impairment.jitter)(
+          random_engine);
+      break;
+    }
+  }
+  return std::max(0.0, impairment.latency + jitter);
+}
+
+void ImpairedLink::schedule(std::optional<unsigned int> client_id,
+                            const void *data, size_t size, double now) {
+  InFlightPacket packet;
+  packet.delivery_time = now + sample_delay();
+  packet.sequence = next_sequence++;
+  packet.client_id = client_id;
+
+  if (std::bernoulli_distribution(impairment.reorder_rate)(random_engine)) {
+    packet.delivery_time += impairment.reorder_delay;
+    reordered_count++;
+  } else {
+    packet.delivery_time =
+        std::max(packet.delivery_time, last_in_order_delivery_time);
+    last_in_order_delivery_time = packet.delivery_time;
+  }
+
+  packet.data.resize(size);
+  std::memcpy(packet.data.data(), data, size);
+  in_flight.push(std::move(packet));
+}
+
+void ImpairedLink::push(std::optional<unsigned int> client_id,
+                        const void *data, size_t size, double now) {
+  if (std::bernoulli_distribution(impairment.drop_rate)(random_engine)) {
+    dropped_count++;
+    return;
+  }
+  schedule(client_id, data, size, now);
+  if (std::bernoulli_distribution(impairment.duplicate_rate)(random_engine)) {
+    duplicated_count++;
+    schedule(client_id, data, size, now);
+  }
+}
+
+std::vector<ImpairedLink::DeliveredPacket>
+ImpairedLink::pop_delivered(double now) {
+  std::vector<DeliveredPacket> delivered;
+  while (not in_flight.empty() and in_flight.top().delivery_time <= now) {
+    // NOTE: top is const, the packet is copied out rather than moved
+    const InFlightPacket &packet = in_flight.top();
+    DeliveredPacket delivered_packet;
+    delivered_packet.client_id = packet.client_id;
+    delivered_packet.packet.data = packet.data;
+    delivered_packet.packet.size = packet.data.size();
+    delivered.push_back(std::move(delivered_packet));
+    in_flight.pop();
+  }
+  return delivered;
+}
+
+SimulatedServerTransport::SimulatedServerTransport(
+    ServerTransport &transport, const NetworkSimSettings &settings,
+    SimulationClock clock)
+    : transport(transport), clock(std::move(clock)),
+      incoming(settings.up, settings.seed),
+      outgoing(settings.down, settings.seed + 1) {}
+
+void SimulatedServerTransport::send_delivered(double now) {
+  for (const auto &delivered : outgoing.pop_delivered(now)) {
+    transport.unreliable_send(*delivered.client_id,
+                              delivered.packet.data.data(),
+                              delivered.packet.size);
+  }
+}
+
+void SimulatedServerTransport::flush() {
+  send_delivered(clock());
+  transport.flush();
+}
+
+std::vector<PacketWithSize>
+SimulatedServerTransport::get_network_events_since_last_tick() {
+  std::vector<PacketWithSize> packets;
+  for (ReceivedPacket &received : get_received_packets_since_last_tick()) {
+    packets.push_back(std::move(received.packet));
+  }
+  return packets;
+}
+
+std::vector<ReceivedPacket>
+SimulatedServerTransport::get_received_packets_since_last_tick() {
+  double now = clock();
+  send_delivered(now);
+
+  for (const ReceivedPacket &received :
+       transport.get_received_packets_since_last_tick()) {
+    incoming.push(received.sender_client_id, received.packet.data.data(),
+                  received.packet.size, now);
+  }
+  auto received_at = std::chrono::steady_clock::now();
+  std::vector<ReceivedPacket> received;
+  for (auto &delivered : incoming.pop_delivered(now)) {
+    received.push_back(
+        {std::move(delivered.packet), received_at, delivered.client_id});
+  }
+  return received;
+}
+
+void SimulatedServerTransport::unreliable_send(unsigned int client_id,
+                                               const void *data, size_t size) {
+  double now = clock();
+  outgoing.push(client_id, data, size, now);
+  send_delivered(now);
+}
+
+SimulatedClientTransport::SimulatedClientTransport(
+    ClientTransport &transport, const NetworkSimSettings &settings,
+    SimulationClock clock)
+    : transport(transport), clock(std::move(clock)),
+      incoming(settings.down, settings.seed),
+      outgoing(settings.up, settings.seed + 1) {}
+
+void SimulatedClientTransport::send_delivered(double now) {
+  for (const auto &delivered : outgoing.pop_delivered(now)) {
+    transport.send_packet(delivered.packet.data.data(), delivered.packet.size);
+  }
+}
+
+std::vector<PacketWithSize>
+SimulatedClientTransport::get_network_events_received_since_last_tick() {
+  double now = clock();
+  send_delivered(now);
+
+  for (const PacketWithSize &packet :
+       transport.get_network_events_received_since_last_tick()) {
+    incoming.push(std::nullopt, packet.data.data(), packet.size, now);
+  }
+  std::vector<PacketWithSize> received;
+  for (auto &delivered : incoming.pop_delivered(now)) {
+    received.push_back(std::move(delivered.packet));
+  }
+  return received;
+}
+
+void SimulatedClientTransport::send_packet(const void *data, size_t size) {
+  double now = clock();
+  outgoing.push(std::nullopt, data, size, now);
+  send_delivered(now);
+}
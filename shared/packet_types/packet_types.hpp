@@ -8,6 +8,18 @@ enum class PacketType : uint8_t {
   MOUSE_UPDATE,
   GAME_UPDATE,
   SOUND_UPDATE,
+  // NOTE: bit packed versions of the above, see wire_format
+  GAME_UPDATE_QUANTIZED,
+  MOUSE_UPDATE_QUANTIZED,
+  // NOTE: a quantized game update that only carries the fields which changed
+  // since a game update the client has acknowledged
+  GAME_UPDATE_DELTA,
+  // NOTE: a game update together with the events of the same tick in one
+  // datagram, see wire_format
+  GAME_FRAME,
+  // NOTE: the newest mouse update along with the ones before it that the
+  // server hasn't acknowledged yet, see wire_format
+  MOUSE_UPDATE_WINDOW,
 };
 
 #endif // PACKET_TYPES_HPP
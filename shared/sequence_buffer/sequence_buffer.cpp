@@ -0,0 +1 @@
+#include "sequence_buffer.hpp"
@@ -0,0 +1,83 @@
+#ifndef SEQUENCE_BUFFER_HPP
+#define SEQUENCE_BUFFER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+// NOTE: a fixed capacity ring of values keyed by consecutive sequence numbers,
+// values are appended with the next number and dropped from the front by
+// moving where the buffer starts, so neither touches the other values and
+// nothing is allocated after construction. It's meant for things like the
+// client's mouse position history where every number is pushed in order and
+// everything before an acknowledged number can go. The capacity is rounded up
+// to a power of two, pushing onto a full buffer discards the oldest value.
+template <typename T> class SequenceBuffer {
+public:
+  explicit SequenceBuffer(size_t capacity)
+      : slots(round_up_to_power_of_two(capacity)), mask(slots.size() - 1) {}
+
+  // NOTE: stores the value under get_end_sequence_number(), which then moves
+  // on by one
+  T &push_back(const T &value) {
+    if (size() == slots.size()) {
+      first_sequence_number++;
+    }
+    T &slot = slots[end_sequence_number & mask];
+    slot = value;
+    end_sequence_number++;
+    return slot;
+  }
+
+  // NOTE: drops everything before sequence_number, numbers at or past the end
+  // empty the buffer, numbers before the start do nothing
+  void discard_before(unsigned int sequence_number) {
+    if (sequence_number > first_sequence_number) {
+      first_sequence_number = std::min(sequence_number, end_sequence_number);
+    }
+  }
+
+  bool contains(unsigned int sequence_number) const {
+    return sequence_number >= first_sequence_number and
+           sequence_number < end_sequence_number;
+  }
+
+  // NOTE: nullptr if the value was discarded or hasn't been pushed yet
+  const T *get(unsigned int sequence_number) const {
+    return contains(sequence_number) ? &slots[sequence_number & mask]
+                                     : nullptr;
+  }
+
+  // NOTE: unchecked, sequence_number has to be contained
+  const T &operator[](unsigned int sequence_number) const {
+    return slots[sequence_number & mask];
+  }
+
+  const T &back() const { return slots[(end_sequence_number - 1) & mask]; }
+
+  bool empty() const { return size() == 0; }
+  size_t size() const { return end_sequence_number - first_sequence_number; }
+  size_t get_capacity() const { return slots.size(); }
+
+  unsigned int get_first_sequence_number() const {
+    return first_sequence_number;
+  }
+  // NOTE: one past the newest value, the number the next push_back gets
+  unsigned int get_end_sequence_number() const { return end_sequence_number; }
+
+private:
+  static size_t round_up_to_power_of_two(size_t value) {
+    size_t power = 1;
+    while (power < value) {
+      power <<= 1;
+    }
+    return power;
+  }
+
+  std::vector<T> slots;
+  size_t mask;
+  unsigned int first_sequence_number = 0;
+  unsigned int end_sequence_number = 0;
+};
+
+#endif // SEQUENCE_BUFFER_HPP
@@ -0,0 +1,11 @@
+#include "transport.hpp"
+
+std::vector<ReceivedPacket>
+ServerTransport::get_received_packets_since_last_tick() {
+  auto now = std::chrono::steady_clock::now();
+  std::vector<ReceivedPacket> received;
+  for (PacketWithSize &packet : get_network_events_since_last_tick()) {
+    received.push_back({std::move(packet), now, std::nullopt});
+  }
+  return received;
+}
@@ -0,0 +1,123 @@
+#ifndef UDP_TRANSPORT_HPP
+#define UDP_TRANSPORT_HPP
+
+// NOTE: plain UDP transports for Linux which move datagrams in batches with
+// recvmmsg and sendmmsg, on the server one tick's worth of sends costs a single
+// system call instead of one per client and packet. There is none of enet's
+// reliability or fragmentation, which this game doesn't use as every packet
+// is sent unreliably and fits in a datagram. A client is whatever address
+// datagrams come from, an empty datagram says hello (and keeps the client
+// alive when it has nothing else to send) and is never handed to the game, a
+// client the server hasn't heard from in a while is considered gone. The
+// client and server must agree on using this, see [network] backend.
+
+#ifdef __linux__
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <netinet/in.h>
+
+#include "../transport/transport.hpp"
+
+class UdpServerTransport : public ServerTransport {
+public:
+  explicit UdpServerTransport(uint16_t port, double client_timeout_seconds = 5);
+  ~UdpServerTransport() override;
+
+  UdpServerTransport(const UdpServerTransport &) = delete;
+  UdpServerTransport &operator=(const UdpServerTransport &) = delete;
+
+  // NOTE: returns false if the socket couldn't be set up, the reason is
+  // logged
+  bool initialize_network();
+
+  std::vector<PacketWithSize> get_network_events_since_last_tick() override;
+  // NOTE: the sender is the client the datagram's address belongs to
+  std::vector<ReceivedPacket> get_received_packets_since_last_tick() override;
+  // NOTE: only queues the datagram, it goes out on the next flush
+  void unreliable_send(unsigned int client_id, const void *data,
+                       size_t size) override;
+  std::vector<unsigned int> get_connected_client_ids() override;
+  void flush() override;
+
+  uint64_t get_send_system_call_count() const {
+    return send_system_call_count;
+  }
+  uint64_t get_receive_system_call_count() const {
+    return receive_system_call_count;
+  }
+  // NOTE: datagrams too long to be ours, they are dropped
+  uint64_t get_truncated_datagram_count() const {
+    return truncated_datagram_count;
+  }
+
+private:
+  struct Client {
+    sockaddr_in address;
+    std::chrono::steady_clock::time_point last_heard_from;
+  };
+  struct OutgoingDatagram {
+    sockaddr_in address;
+    std::vector<char> data;
+  };
+
+  void forget_silent_clients();
+
+  uint16_t port;
+  std::chrono::duration<double> client_timeout;
+  int socket_fd = -1;
+
+  unsigned int next_client_id = 0;
+  std::map<unsigned int, Client> client_id_to_client;
+  // NOTE: keyed by address and port packed together, see address_key
+  std::map<uint64_t, unsigned int> address_to_client_id;
+
+  std::vector<OutgoingDatagram> outgoing;
+
+  uint64_t send_system_call_count = 0;
+  uint64_t receive_system_call_count = 0;
+  uint64_t truncated_datagram_count = 0;
+};
+
+class UdpClientTransport : public ClientTransport {
+public:
+  UdpClientTransport(const std::string &server_host, uint16_t port);
+  ~UdpClientTransport() override;
+
+  UdpClientTransport(const UdpClientTransport &) = delete;
+  UdpClientTransport &operator=(const UdpClientTransport &) = delete;
+
+  // NOTE: returns false if the server's address couldn't be resolved or the
+  // socket couldn't be set up, the reason is logged
+  bool initialize_network();
+  // NOTE: says hello, it is repeated until the server answers
+  void attempt_to_connect_to_server();
+
+  std::vector<PacketWithSize>
+  get_network_events_received_since_last_tick() override;
+  void send_packet(const void *data, size_t size) override;
+
+  // NOTE: datagrams too long to be ours, they are dropped
+  uint64_t get_truncated_datagram_count() const {
+    return truncated_datagram_count;
+  }
+
+private:
+  void send_hello();
+
+  std::string server_host;
+  uint16_t port;
+  int socket_fd = -1;
+  bool connecting = false;
+  bool heard_from_server = false;
+  std::chrono::steady_clock::time_point last_sent;
+  uint64_t truncated_datagram_count = 0;
+};
+
+#endif // __linux__
+
+#endif // UDP_TRANSPORT_HPP
@@ -0,0 +1,925 @@
+#include "wire_format.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+
+namespace wire_format {
+
+// NOTE: the helpers below mirror the encodings used by the generated
+// MetaProgram, enums with an explicit underlying type are written as that
+// type, plain enums as an int and bools as a single byte.
+
+static void serialize_bool(bool value, ByteWriter &writer) {
+  uint8_t raw = value ? 1 : 0;
+  writer.write_trivial(raw);
+}
+
+static bool deserialize_bool(ByteReader &reader, bool &value) {
+  uint8_t raw = 0;
+  if (not reader.read_trivial(raw)) {
+    return false;
+  }
+  value = raw != 0;
+  return true;
+}
+
+static void serialize_sound_type(SoundType sound_type, ByteWriter &writer) {
+  int raw = static_cast<int>(sound_type);
+  writer.write_trivial(raw);
+}
+
+static bool deserialize_sound_type(ByteReader &reader, SoundType &sound_type) {
+  int raw = 0;
+  if (not reader.read_trivial(raw)) {
+    return false;
+  }
+  sound_type = static_cast<SoundType>(raw);
+  return true;
+}
+
+void serialize(const PacketHeader &header, ByteWriter &writer) {
+  uint8_t raw_type = static_cast<uint8_t>(header.type);
+  writer.write_trivial(raw_type);
+  writer.write_trivial(header.size_of_data_without_header);
+}
+
+void serialize(const MouseUpdate &mouse_update, ByteWriter &writer) {
+  writer.write_trivial(mouse_update.client_id);
+  writer.write_trivial(mouse_update.mouse_pos_update_number);
+  serialize_bool(mouse_update.has_received_game_update, writer);
+  writer.write_trivial(mouse_update.last_received_game_update_number);
+  writer.write_trivial(
+      mouse_update
+          .last_applied_game_update_number_before_firing_entity_interpolation);
+  writer.write_trivial(
+      mouse_update.last_applied_game_update_number_before_firing_camera_cpsr);
+  writer.write_trivial(mouse_update.subtick_percentage_when_fire_pressed);
+  writer.write_trivial(mouse_update.entity_extrapolation_when_fire_pressed);
+  writer.write_trivial(mouse_update.subtick_x_pos_before_firing);
+  writer.write_trivial(mouse_update.subtick_y_pos_before_firing);
+  writer.write_trivial(mouse_update.x_pos);
+  writer.write_trivial(mouse_update.y_pos);
+  serialize_bool(mouse_update.fire_pressed, writer);
+  writer.write_trivial(mouse_update.sensitivity);
+}
+
+void serialize(const GameUpdate &game_update, ByteWriter &writer) {
+  writer.write_trivial(game_update.client_id);
+  writer.write_trivial(game_update.last_processed_mouse_pos_update_number);
+  writer.write_trivial(game_update.update_number);
+  writer.write_trivial(game_update.yaw);
+  writer.write_trivial(game_update.pitch);
+  writer.write_trivial(game_update.target_x_pos);
+  writer.write_trivial(game_update.target_y_pos);
+  writer.write_trivial(game_update.target_z_pos);
+  writer.write_trivial(game_update.target_x_vel);
+  writer.write_trivial(game_update.target_y_vel);
+  writer.write_trivial(game_update.target_z_vel);
+}
+
+void serialize(const SoundUpdate &sound_update, ByteWriter &writer) {
+  serialize_sound_type(sound_update.sound_to_play, writer);
+  writer.write_trivial(sound_update.x);
+  writer.write_trivial(sound_update.y);
+  writer.write_trivial(sound_update.z);
+}
+
+void serialize(const MouseUpdatePacket &packet, ByteWriter &writer) {
+  serialize(packet.header, writer);
+  serialize(packet.mouse_update, writer);
+}
+
+void serialize(const GameUpdatePacket &packet, ByteWriter &writer) {
+  serialize(packet.header, writer);
+  serialize(packet.game_update, writer);
+}
+
+void serialize(const SoundUpdatePacket &packet, ByteWriter &writer) {
+  serialize(packet.header, writer);
+  serialize(packet.sound_update, writer);
+}
+
+bool deserialize(ByteReader &reader, PacketHeader &header) {
+  uint8_t raw_type = 0;
+  if (not reader.read_trivial(raw_type)) {
+    return false;
+  }
+  header.type = static_cast<PacketType>(raw_type);
+  return reader.read_trivial(header.size_of_data_without_header);
+}
+
+bool deserialize(ByteReader &reader, MouseUpdate &mouse_update) {
+  return reader.read_trivial(mouse_update.client_id) and
+         reader.read_trivial(mouse_update.mouse_pos_update_number) and
+         deserialize_bool(reader, mouse_update.has_received_game_update) and
+         reader.read_trivial(mouse_update.last_received_game_update_number) and
+         reader.read_trivial(
+             mouse_update
+                 .last_applied_game_update_number_before_firing_entity_interpolation) and
+         reader.read_trivial(
+             mouse_update
+                 .last_applied_game_update_number_before_firing_camera_cpsr) and
+         reader.read_trivial(
+             mouse_update.subtick_percentage_when_fire_pressed) and
+         reader.read_trivial(
+             mouse_update.entity_extrapolation_when_fire_pressed) and
+         reader.read_trivial(mouse_update.subtick_x_pos_before_firing) and
+         reader.read_trivial(mouse_update.subtick_y_pos_before_firing) and
+         reader.read_trivial(mouse_update.x_pos) and
+         reader.read_trivial(mouse_update.y_pos) and
+         deserialize_bool(reader, mouse_update.fire_pressed) and
+         reader.read_trivial(mouse_update.sensitivity);
+}
+
+bool deserialize(ByteReader &reader, GameUpdate &game_update) {
+  return reader.read_trivial(game_update.client_id) and
+         reader.read_trivial(
+             game_update.last_processed_mouse_pos_update_number) and
+         reader.read_trivial(game_update.update_number) and
+         reader.read_trivial(game_update.yaw) and
+         reader.read_trivial(game_update.pitch) and
+         reader.read_trivial(game_update.target_x_pos) and
+         reader.read_trivial(game_update.target_y_pos) and
+         reader.read_trivial(game_update.target_z_pos) and
+         reader.read_trivial(game_update.target_x_vel) and
+         reader.read_trivial(game_update.target_y_vel) and
+         reader.read_trivial(game_update.target_z_vel);
+}
+
+bool deserialize(ByteReader &reader, SoundUpdate &sound_update) {
+  return deserialize_sound_type(reader, sound_update.sound_to_play) and
+         reader.read_trivial(sound_update.x) and
+         reader.read_trivial(sound_update.y) and
+         reader.read_trivial(sound_update.z);
+}
+
+bool deserialize(ByteReader &reader, MouseUpdatePacket &packet) {
+  return deserialize(reader, packet.header) and
+         deserialize(reader, packet.mouse_update);
+}
+
+bool deserialize(ByteReader &reader, GameUpdatePacket &packet) {
+  return deserialize(reader, packet.header) and
+         deserialize(reader, packet.game_update);
+}
+
+bool deserialize(ByteReader &reader, SoundUpdatePacket &packet) {
+  return deserialize(reader, packet.header) and
+         deserialize(reader, packet.sound_update);
+}
+
+uint32_t quantize(double value, const QuantizedRange &range) {
+  double clamped = std::clamp(value, range.min, range.max);
+  double normalized = (clamped - range.min) / (range.max - range.min);
+  return static_cast<uint32_t>(
+      std::lround(normalized * range.get_max_quantized_value()));
+}
+
+double dequantize(uint32_t quantized_value, const QuantizedRange &range) {
+  double normalized =
+      static_cast<double>(quantized_value) / range.get_max_quantized_value();
+  return range.min + normalized * (range.max - range.min);
+}
+
+unsigned int reconstruct_sequence_number(uint32_t low_bits,
+                                         unsigned int reference) {
+  // NOTE: the difference is computed modulo 2^16 and then interpreted as
+  // signed, so the result is the candidate nearest to the reference
+  uint16_t difference = static_cast<uint16_t>(
+      low_bits - static_cast<uint16_t>(reference));
+  return reference + static_cast<int16_t>(difference);
+}
+
+static void write_sequence_number(unsigned int sequence_number,
+                                  BitWriter &writer) {
+  writer.write_bits(sequence_number, sequence_number_bit_count);
+}
+
+static bool read_sequence_number(BitReader &reader, unsigned int reference,
+                                 unsigned int &sequence_number) {
+  uint32_t low_bits = 0;
+  if (not reader.read_bits(low_bits, sequence_number_bit_count)) {
+    return false;
+  }
+  sequence_number = reconstruct_sequence_number(low_bits, reference);
+  return true;
+}
+
+// NOTE: a game update number, which a client that just joined has no
+// reference for, see full_sequence_number_bit_count
+static void write_game_update_number(unsigned int update_number,
+                                     bool send_full_update_number,
+                                     BitWriter &writer) {
+  writer.write_bool(send_full_update_number);
+  if (send_full_update_number) {
+    writer.write_bits(update_number, full_sequence_number_bit_count);
+  } else {
+    write_sequence_number(update_number, writer);
+  }
+}
+
+static bool read_game_update_number(BitReader &reader, unsigned int reference,
+                                    unsigned int &update_number) {
+  bool is_full = false;
+  if (not reader.read_bool(is_full)) {
+    return false;
+  }
+  if (not is_full) {
+    return read_sequence_number(reader, reference, update_number);
+  }
+  uint32_t full_update_number = 0;
+  if (not reader.read_bits(full_update_number,
+                           full_sequence_number_bit_count)) {
+    return false;
+  }
+  update_number = full_update_number;
+  return true;
+}
+
+static bool read_quantized(BitReader &reader, const QuantizedRange &range,
+                           double &value) {
+  uint32_t quantized_value = 0;
+  if (not reader.read_bits(quantized_value, range.bit_count)) {
+    return false;
+  }
+  value = dequantize(quantized_value, range);
+  return true;
+}
+
+static void write_mouse_position(double position, BitWriter &writer) {
+  double fixed_point = std::clamp(
+      std::round(position * quantization::mouse_position_fixed_point_scale),
+      static_cast<double>(std::numeric_limits<int32_t>::min()),
+      static_cast<double>(std::numeric_limits<int32_t>::max()));
+  writer.write_bits(static_cast<uint32_t>(static_cast<int32_t>(fixed_point)),
+                    quantization::mouse_position_bit_count);
+}
+
+static bool read_mouse_position(BitReader &reader, double &position) {
+  uint32_t raw = 0;
+  if (not reader.read_bits(raw, quantization::mouse_position_bit_count)) {
+    return false;
+  }
+  position = static_cast<int32_t>(raw) /
+             quantization::mouse_position_fixed_point_scale;
+  return true;
+}
+
+// NOTE: the fields a mouse update only carries when fire_pressed is set
+static void write_firing_fields(const MouseUpdate &mouse_update,
+                                BitWriter &writer) {
+  write_sequence_number(
+      mouse_update
+          .last_applied_game_update_number_before_firing_entity_interpolation,
+      writer);
+  write_sequence_number(
+      mouse_update.last_applied_game_update_number_before_firing_camera_cpsr,
+      writer);
+  writer.write_bits(quantize(mouse_update.subtick_percentage_when_fire_pressed,
+                             quantization::subtick_percentage),
+                    quantization::subtick_percentage.bit_count);
+  bool is_extrapolated =
+      mouse_update.entity_extrapolation_when_fire_pressed > 0;
+  writer.write_bool(is_extrapolated);
+  if (is_extrapolated) {
+    writer.write_bits(
+        quantize(mouse_update.entity_extrapolation_when_fire_pressed,
+                 quantization::entity_extrapolation),
+        quantization::entity_extrapolation.bit_count);
+  }
+  writer.write_bits(
+      quantize(mouse_update.subtick_x_pos_before_firing - mouse_update.x_pos,
+               quantization::subtick_mouse_position_offset),
+      quantization::subtick_mouse_position_offset.bit_count);
+  writer.write_bits(
+      quantize(mouse_update.subtick_y_pos_before_firing - mouse_update.y_pos,
+               quantization::subtick_mouse_position_offset),
+      quantization::subtick_mouse_position_offset.bit_count);
+}
+
+// NOTE: zeroes the firing fields when fire_pressed isn't set so that they come
+// out the same as the unquantized ones would, the position has to be read
+// already as the subtick position is relative to it
+static bool read_firing_fields(BitReader &reader,
+                               unsigned int game_update_number_reference,
+                               MouseUpdate &mouse_update) {
+  mouse_update.last_applied_game_update_number_before_firing_entity_interpolation = 0;
+  mouse_update.last_applied_game_update_number_before_firing_camera_cpsr = 0;
+  mouse_update.subtick_percentage_when_fire_pressed = 0;
+  mouse_update.entity_extrapolation_when_fire_pressed = 0;
+  mouse_update.subtick_x_pos_before_firing = 0;
+  mouse_update.subtick_y_pos_before_firing = 0;
+
+  if (not mouse_update.fire_pressed) {
+    return true;
+  }
+
+  double subtick_x_offset = 0, subtick_y_offset = 0;
+  bool is_extrapolated = false;
+  bool read_ok =
+      read_sequence_number(
+          reader, game_update_number_reference,
+          mouse_update
+              .last_applied_game_update_number_before_firing_entity_interpolation) and
+      read_sequence_number(
+          reader, game_update_number_reference,
+          mouse_update.last_applied_game_update_number_before_firing_camera_cpsr) and
+      read_quantized(reader, quantization::subtick_percentage,
+                     mouse_update.subtick_percentage_when_fire_pressed) and
+      reader.read_bool(is_extrapolated) and
+      (not is_extrapolated or
+       read_quantized(reader, quantization::entity_extrapolation,
+                      mouse_update.entity_extrapolation_when_fire_pressed)) and
+      read_quantized(reader, quantization::subtick_mouse_position_offset,
+                     subtick_x_offset) and
+      read_quantized(reader, quantization::subtick_mouse_position_offset,
+                     subtick_y_offset);
+  mouse_update.subtick_x_pos_before_firing = mouse_update.x_pos + subtick_x_offset;
+  mouse_update.subtick_y_pos_before_firing = mouse_update.y_pos + subtick_y_offset;
+  return read_ok;
+}
+
+// NOTE: positions in a mouse update window are written relative to the same
+// position in the next newer mouse update, in 1/16 px fixed point, the
+// difference takes mouse_position_difference_bit_count bits when it fits and
+// the position is written in full when it doesn't
+static int32_t to_mouse_position_fixed_point(double position) {
+  return static_cast<int32_t>(std::clamp(
+      std::round(position * quantization::mouse_position_fixed_point_scale),
+      static_cast<double>(std::numeric_limits<int32_t>::min()),
+      static_cast<double>(std::numeric_limits<int32_t>::max())));
+}
+
+static void write_mouse_position_relative(double position,
+                                          double newer_position,
+                                          BitWriter &writer) {
+  constexpr int64_t max_difference =
+      (int64_t(1) << (quantization::mouse_position_difference_bit_count - 1)) - 1;
+  int64_t difference = int64_t(to_mouse_position_fixed_point(position)) -
+                       to_mouse_position_fixed_point(newer_position);
+  bool fits = difference >= -max_difference - 1 and difference <= max_difference;
+  writer.write_bool(fits);
+  if (fits) {
+    writer.write_bits(static_cast<uint32_t>(difference),
+                      quantization::mouse_position_difference_bit_count);
+  } else {
+    write_mouse_position(position, writer);
+  }
+}
+
+static bool read_mouse_position_relative(BitReader &reader,
+                                         double newer_position,
+                                         double &position) {
+  bool fits = false;
+  if (not reader.read_bool(fits)) {
+    return false;
+  }
+  if (not fits) {
+    return read_mouse_position(reader, position);
+  }
+  constexpr unsigned int bit_count =
+      quantization::mouse_position_difference_bit_count;
+  uint32_t raw = 0;
+  if (not reader.read_bits(raw, bit_count)) {
+    return false;
+  }
+  // NOTE: sign extend
+  int32_t difference = static_cast<int32_t>(raw << (32 - bit_count)) >>
+                       (32 - bit_count);
+  position = (int64_t(to_mouse_position_fixed_point(newer_position)) +
+              difference) /
+             quantization::mouse_position_fixed_point_scale;
+  return true;
+}
+
+// NOTE: writes the header with the final payload size in front of the bits
+template <size_t max_payload_size, typename EncodeFunction>
+static void serialize_bit_packed(PacketType type, ByteWriter &writer,
+                                 EncodeFunction encode) {
+  std::array<uint8_t, max_payload_size> payload{};
+  BitWriter bit_writer(payload);
+  encode(bit_writer);
+  bit_writer.finish();
+
+  PacketHeader header;
+  header.type = type;
+  header.size_of_data_without_header =
+      static_cast<uint32_t>(bit_writer.get_bytes_written());
+  serialize(header, writer);
+  writer.write_bytes(payload.data(), bit_writer.get_bytes_written());
+}
+
+void serialize_quantized(const GameUpdate &game_update,
+                         bool send_full_update_number, ByteWriter &writer) {
+  constexpr size_t max_payload_size =
+      quantization::bits_to_bytes(quantization::game_update_bit_count);
+  serialize_bit_packed<max_payload_size>(
+      PacketType::GAME_UPDATE_QUANTIZED, writer, [&](BitWriter &bit_writer) {
+        bit_writer.write_bits(game_update.client_id,
+                              quantization::client_id_bit_count);
+        write_sequence_number(game_update.last_processed_mouse_pos_update_number,
+                              bit_writer);
+        write_game_update_number(game_update.update_number,
+                                 send_full_update_number, bit_writer);
+        double wrapped_yaw = std::remainder(game_update.yaw, 2 * std::numbers::pi);
+        bit_writer.write_bits(quantize(wrapped_yaw, quantization::yaw),
+                              quantization::yaw.bit_count);
+        bit_writer.write_bits(quantize(game_update.pitch, quantization::pitch),
+                              quantization::pitch.bit_count);
+        for (double position : {game_update.target_x_pos,
+                                game_update.target_y_pos,
+                                game_update.target_z_pos}) {
+          bit_writer.write_bits(
+              quantize(position, quantization::target_position),
+              quantization::target_position.bit_count);
+        }
+        for (double velocity : {game_update.target_x_vel,
+                                game_update.target_y_vel,
+                                game_update.target_z_vel}) {
+          bit_writer.write_bits(
+              quantize(velocity, quantization::target_velocity),
+              quantization::target_velocity.bit_count);
+        }
+      });
+}
+
+void serialize_quantized(const MouseUpdate &mouse_update, ByteWriter &writer) {
+  constexpr size_t max_payload_size =
+      quantization::bits_to_bytes(quantization::mouse_update_max_bit_count);
+  serialize_bit_packed<max_payload_size>(
+      PacketType::MOUSE_UPDATE_QUANTIZED, writer, [&](BitWriter &bit_writer) {
+        bit_writer.write_bits(mouse_update.client_id,
+                              quantization::client_id_bit_count);
+        write_sequence_number(mouse_update.mouse_pos_update_number, bit_writer);
+        bit_writer.write_bool(mouse_update.has_received_game_update);
+        if (mouse_update.has_received_game_update) {
+          write_sequence_number(mouse_update.last_received_game_update_number,
+                                bit_writer);
+        }
+        write_mouse_position(mouse_update.x_pos, bit_writer);
+        write_mouse_position(mouse_update.y_pos, bit_writer);
+        bit_writer.write_bits(
+            std::bit_cast<uint32_t>(static_cast<float>(mouse_update.sensitivity)),
+            quantization::sensitivity_bit_count);
+        bit_writer.write_bool(mouse_update.fire_pressed);
+
+        if (mouse_update.fire_pressed) {
+          write_firing_fields(mouse_update, bit_writer);
+        }
+      });
+}
+
+bool deserialize_quantized(ByteReader &reader, GameUpdate &game_update,
+                           unsigned int update_number_reference,
+                           unsigned int mouse_pos_update_number_reference) {
+  PacketHeader header;
+  std::span<const uint8_t> payload;
+  if (not deserialize(reader, header) or
+      not reader.read_span(header.size_of_data_without_header, payload)) {
+    return false;
+  }
+
+  BitReader bit_reader(payload);
+  uint32_t client_id = 0;
+  if (not bit_reader.read_bits(client_id, quantization::client_id_bit_count)) {
+    return false;
+  }
+  game_update.client_id = client_id;
+  return read_sequence_number(
+             bit_reader, mouse_pos_update_number_reference,
+             game_update.last_processed_mouse_pos_update_number) and
+         read_game_update_number(bit_reader, update_number_reference,
+                                 game_update.update_number) and
+         read_quantized(bit_reader, quantization::yaw, game_update.yaw) and
+         read_quantized(bit_reader, quantization::pitch, game_update.pitch) and
+         read_quantized(bit_reader, quantization::target_position,
+                        game_update.target_x_pos) and
+         read_quantized(bit_reader, quantization::target_position,
+                        game_update.target_y_pos) and
+         read_quantized(bit_reader, quantization::target_position,
+                        game_update.target_z_pos) and
+         read_quantized(bit_reader, quantization::target_velocity,
+                        game_update.target_x_vel) and
+         read_quantized(bit_reader, quantization::target_velocity,
+                        game_update.target_y_vel) and
+         read_quantized(bit_reader, quantization::target_velocity,
+                        game_update.target_z_vel);
+}
+
+// NOTE: the fields a delta game update can omit, quantized exactly as they are
+// on the wire, two game updates with equal entries here decode identically, in
+// the order of quantization::delta_game_update_field_bit_counts
+using DeltaGameUpdateFields =
+    std::array<uint32_t, quantization::delta_game_update_field_bit_counts.size()>;
+
+static DeltaGameUpdateFields
+get_delta_game_update_fields(const GameUpdate &game_update) {
+  uint32_t sequence_number_mask = (uint32_t(1) << sequence_number_bit_count) - 1;
+  double wrapped_yaw = std::remainder(game_update.yaw, 2 * std::numbers::pi);
+  return {game_update.client_id,
+          game_update.last_processed_mouse_pos_update_number &
+              sequence_number_mask,
+          quantize(wrapped_yaw, quantization::yaw),
+          quantize(game_update.pitch, quantization::pitch),
+          quantize(game_update.target_x_pos, quantization::target_position),
+          quantize(game_update.target_y_pos, quantization::target_position),
+          quantize(game_update.target_z_pos, quantization::target_position),
+          quantize(game_update.target_x_vel, quantization::target_velocity),
+          quantize(game_update.target_y_vel, quantization::target_velocity),
+          quantize(game_update.target_z_vel, quantization::target_velocity)};
+}
+
+void serialize_delta(const GameUpdate &game_update, const GameUpdate *baseline,
+                     ByteWriter &writer) {
+  constexpr size_t max_payload_size = quantization::bits_to_bytes(
+      quantization::delta_game_update_max_bit_count);
+  constexpr auto &field_bit_counts =
+      quantization::delta_game_update_field_bit_counts;
+
+  serialize_bit_packed<max_payload_size>(
+      PacketType::GAME_UPDATE_DELTA, writer, [&](BitWriter &bit_writer) {
+        bit_writer.write_bool(baseline != nullptr);
+
+        DeltaGameUpdateFields fields = get_delta_game_update_fields(game_update);
+        uint32_t changed_fields_mask = (uint32_t(1) << field_bit_counts.size()) - 1;
+        if (baseline == nullptr) {
+          bit_writer.write_bits(game_update.update_number,
+                                full_sequence_number_bit_count);
+        } else {
+          write_sequence_number(game_update.update_number, bit_writer);
+          write_sequence_number(baseline->update_number, bit_writer);
+          DeltaGameUpdateFields baseline_fields =
+              get_delta_game_update_fields(*baseline);
+          changed_fields_mask = 0;
+          for (size_t i = 0; i < fields.size(); i++) {
+            if (fields[i] != baseline_fields[i]) {
+              changed_fields_mask |= uint32_t(1) << i;
+            }
+          }
+        }
+
+        bit_writer.write_bits(changed_fields_mask, field_bit_counts.size());
+        for (size_t i = 0; i < fields.size(); i++) {
+          if (changed_fields_mask & (uint32_t(1) << i)) {
+            bit_writer.write_bits(fields[i], field_bit_counts[i]);
+          }
+        }
+      });
+}
+
+bool deserialize_delta(
+    ByteReader &reader, GameUpdate &game_update,
+    unsigned int update_number_reference,
+    unsigned int mouse_pos_update_number_reference,
+    const std::function<const GameUpdate *(unsigned int)> &get_baseline) {
+  constexpr auto &field_bit_counts =
+      quantization::delta_game_update_field_bit_counts;
+
+  PacketHeader header;
+  std::span<const uint8_t> payload;
+  if (not deserialize(reader, header) or
+      not reader.read_span(header.size_of_data_without_header, payload)) {
+    return false;
+  }
+
+  BitReader bit_reader(payload);
+  bool has_baseline = false;
+  if (not bit_reader.read_bool(has_baseline)) {
+    return false;
+  }
+
+  // NOTE: re-quantizing the baseline gives back exactly the values that were
+  // compared against on the server because it was itself decoded from them,
+  // the baseline is at most the rewind window behind the update so its number
+  // is reconstructed from the update's
+  unsigned int update_number = 0;
+  DeltaGameUpdateFields fields{};
+  if (not has_baseline) {
+    uint32_t full_update_number = 0;
+    if (not bit_reader.read_bits(full_update_number,
+                                 full_sequence_number_bit_count)) {
+      return false;
+    }
+    update_number = full_update_number;
+  } else {
+    unsigned int baseline_update_number = 0;
+    if (not read_sequence_number(bit_reader, update_number_reference,
+                                 update_number) or
+        not read_sequence_number(bit_reader, update_number,
+                                 baseline_update_number)) {
+      return false;
+    }
+    const GameUpdate *baseline = get_baseline(baseline_update_number);
+    if (baseline == nullptr) {
+      return false;
+    }
+    fields = get_delta_game_update_fields(*baseline);
+  }
+
+  uint32_t changed_fields_mask = 0;
+  if (not bit_reader.read_bits(changed_fields_mask, field_bit_counts.size())) {
+    return false;
+  }
+  for (size_t i = 0; i < fields.size(); i++) {
+    if ((changed_fields_mask & (uint32_t(1) << i)) and
+        not bit_reader.read_bits(fields[i], field_bit_counts[i])) {
+      return false;
+    }
+  }
+
+  game_update.update_number = update_number;
+  game_update.client_id = fields[0];
+  game_update.last_processed_mouse_pos_update_number =
+      reconstruct_sequence_number(fields[1], mouse_pos_update_number_reference);
+  game_update.yaw = dequantize(fields[2], quantization::yaw);
+  game_update.pitch = dequantize(fields[3], quantization::pitch);
+  game_update.target_x_pos = dequantize(fields[4], quantization::target_position);
+  game_update.target_y_pos = dequantize(fields[5], quantization::target_position);
+  game_update.target_z_pos = dequantize(fields[6], quantization::target_position);
+  game_update.target_x_vel = dequantize(fields[7], quantization::target_velocity);
+  game_update.target_y_vel = dequantize(fields[8], quantization::target_velocity);
+  game_update.target_z_vel = dequantize(fields[9], quantization::target_velocity);
+  return true;
+}
+
+bool deserialize_quantized(ByteReader &reader, MouseUpdate &mouse_update,
+                           unsigned int mouse_pos_update_number_reference,
+                           unsigned int game_update_number_reference) {
+  PacketHeader header;
+  std::span<const uint8_t> payload;
+  if (not deserialize(reader, header) or
+      not reader.read_span(header.size_of_data_without_header, payload)) {
+    return false;
+  }
+
+  BitReader bit_reader(payload);
+  mouse_update.last_received_game_update_number = 0;
+  uint32_t client_id = 0;
+  if (not bit_reader.read_bits(client_id, quantization::client_id_bit_count) or
+      not read_sequence_number(bit_reader, mouse_pos_update_number_reference,
+                               mouse_update.mouse_pos_update_number) or
+      not bit_reader.read_bool(mouse_update.has_received_game_update)) {
+    return false;
+  }
+  mouse_update.client_id = client_id;
+  if (mouse_update.has_received_game_update and
+      not read_sequence_number(
+          bit_reader, game_update_number_reference,
+          mouse_update.last_received_game_update_number)) {
+    return false;
+  }
+
+  uint32_t raw_sensitivity = 0;
+  bool read_ok =
+      read_mouse_position(bit_reader, mouse_update.x_pos) and
+      read_mouse_position(bit_reader, mouse_update.y_pos) and
+      bit_reader.read_bits(raw_sensitivity,
+                           quantization::sensitivity_bit_count) and
+      bit_reader.read_bool(mouse_update.fire_pressed);
+  if (not read_ok) {
+    return false;
+  }
+  mouse_update.sensitivity = std::bit_cast<float>(raw_sensitivity);
+
+  return read_firing_fields(bit_reader, game_update_number_reference,
+                            mouse_update);
+}
+
+void serialize_mouse_update_window(std::span<const MouseUpdate> mouse_updates,
+                                   ByteWriter &writer) {
+  // NOTE: walk back from the newest for as long as the gaps can be encoded
+  size_t count = 0;
+  while (count < mouse_updates.size() and
+         count < quantization::max_mouse_update_window_size) {
+    if (count > 0) {
+      const MouseUpdate &newer = mouse_updates[mouse_updates.size() - count];
+      const MouseUpdate &older = mouse_updates[mouse_updates.size() - count - 1];
+      unsigned int gap =
+          newer.mouse_pos_update_number - older.mouse_pos_update_number;
+      if (gap == 0 or
+          gap >= (1u << quantization::mouse_update_window_gap_bit_count)) {
+        break;
+      }
+    }
+    count++;
+  }
+  std::span<const MouseUpdate> window = mouse_updates.last(count);
+  const MouseUpdate &newest = window.back();
+
+  constexpr size_t max_payload_size =
+      quantization::bits_to_bytes(quantization::mouse_update_window_max_bit_count);
+  serialize_bit_packed<max_payload_size>(
+      PacketType::MOUSE_UPDATE_WINDOW, writer, [&](BitWriter &bit_writer) {
+        bit_writer.write_bits(newest.client_id,
+                              quantization::client_id_bit_count);
+        bit_writer.write_bits(static_cast<uint32_t>(count - 1),
+                              quantization::mouse_update_window_count_bit_count);
+        bit_writer.write_bool(newest.has_received_game_update);
+        if (newest.has_received_game_update) {
+          write_sequence_number(newest.last_received_game_update_number,
+                                bit_writer);
+        }
+
+        write_sequence_number(newest.mouse_pos_update_number, bit_writer);
+        write_mouse_position(newest.x_pos, bit_writer);
+        write_mouse_position(newest.y_pos, bit_writer);
+        bit_writer.write_bits(
+            std::bit_cast<uint32_t>(static_cast<float>(newest.sensitivity)),
+            quantization::sensitivity_bit_count);
+        bit_writer.write_bool(newest.fire_pressed);
+        if (newest.fire_pressed) {
+          write_firing_fields(newest, bit_writer);
+        }
+
+        for (size_t i = count - 1; i-- > 0;) {
+          const MouseUpdate &newer = window[i + 1];
+          const MouseUpdate &older = window[i];
+          unsigned int gap =
+              newer.mouse_pos_update_number - older.mouse_pos_update_number;
+          bit_writer.write_bool(gap == 1);
+          if (gap != 1) {
+            bit_writer.write_bits(
+                gap, quantization::mouse_update_window_gap_bit_count);
+          }
+          write_mouse_position_relative(older.x_pos, newer.x_pos, bit_writer);
+          write_mouse_position_relative(older.y_pos, newer.y_pos, bit_writer);
+          float sensitivity = static_cast<float>(older.sensitivity);
+          bool sensitivity_changed =
+              sensitivity != static_cast<float>(newer.sensitivity);
+          bit_writer.write_bool(sensitivity_changed);
+          if (sensitivity_changed) {
+            bit_writer.write_bits(std::bit_cast<uint32_t>(sensitivity),
+                                  quantization::sensitivity_bit_count);
+          }
+          bit_writer.write_bool(older.fire_pressed);
+          if (older.fire_pressed) {
+            write_firing_fields(older, bit_writer);
+          }
+        }
+      });
+}
+
+bool deserialize_mouse_update_window(
+    ByteReader &reader, std::vector<MouseUpdate> &mouse_updates,
+    unsigned int mouse_pos_update_number_reference,
+    unsigned int game_update_number_reference) {
+  PacketHeader header;
+  std::span<const uint8_t> payload;
+  if (not deserialize(reader, header) or
+      not reader.read_span(header.size_of_data_without_header, payload)) {
+    return false;
+  }
+
+  BitReader bit_reader(payload);
+  MouseUpdate newest{};
+  uint32_t client_id = 0, count_minus_one = 0, raw_sensitivity = 0;
+  if (not bit_reader.read_bits(client_id, quantization::client_id_bit_count) or
+      not bit_reader.read_bits(
+          count_minus_one, quantization::mouse_update_window_count_bit_count) or
+      not bit_reader.read_bool(newest.has_received_game_update)) {
+    return false;
+  }
+  newest.client_id = client_id;
+  if (newest.has_received_game_update and
+      not read_sequence_number(bit_reader, game_update_number_reference,
+                               newest.last_received_game_update_number)) {
+    return false;
+  }
+  bool read_ok =
+      read_sequence_number(bit_reader, mouse_pos_update_number_reference,
+                           newest.mouse_pos_update_number) and
+      read_mouse_position(bit_reader, newest.x_pos) and
+      read_mouse_position(bit_reader, newest.y_pos) and
+      bit_reader.read_bits(raw_sensitivity,
+                           quantization::sensitivity_bit_count) and
+      bit_reader.read_bool(newest.fire_pressed);
+  if (not read_ok) {
+    return false;
+  }
+  newest.sensitivity = std::bit_cast<float>(raw_sensitivity);
+  if (not read_firing_fields(bit_reader, game_update_number_reference,
+                             newest)) {
+    return false;
+  }
+
+  // NOTE: read newest first, so they're put in order afterwards
+  std::array<MouseUpdate, quantization::max_mouse_update_window_size> window;
+  size_t count = count_minus_one + 1;
+  window[count - 1] = newest;
+  for (size_t i = count - 1; i-- > 0;) {
+    const MouseUpdate &newer = window[i + 1];
+    MouseUpdate &older = window[i];
+    older = newer;
+    uint32_t gap = 1;
+    bool is_consecutive = false;
+    if (not bit_reader.read_bool(is_consecutive) or
+        (not is_consecutive and
+         not bit_reader.read_bits(
+             gap, quantization::mouse_update_window_gap_bit_count))) {
+      return false;
+    }
+    bool sensitivity_changed = false;
+    read_ok = read_mouse_position_relative(bit_reader, newer.x_pos,
+                                           older.x_pos) and
+              read_mouse_position_relative(bit_reader, newer.y_pos,
+                                           older.y_pos) and
+              bit_reader.read_bool(sensitivity_changed);
+    if (not read_ok) {
+      return false;
+    }
+    older.mouse_pos_update_number = newer.mouse_pos_update_number - gap;
+    if (sensitivity_changed) {
+      if (not bit_reader.read_bits(raw_sensitivity,
+                                   quantization::sensitivity_bit_count)) {
+        return false;
+      }
+      older.sensitivity = std::bit_cast<float>(raw_sensitivity);
+    }
+    if (not bit_reader.read_bool(older.fire_pressed) or
+        not read_firing_fields(bit_reader, game_update_number_reference,
+                               older)) {
+      return false;
+    }
+  }
+
+  mouse_updates.insert(mouse_updates.end(), window.begin(),
+                       window.begin() + count);
+  return true;
+}
+
+void start_game_frame(std::vector<uint8_t> &frame) {
+  frame.clear();
+  PacketHeader header;
+  header.type = PacketType::GAME_FRAME;
+  header.size_of_data_without_header = 0;
+  ByteWriter writer(frame);
+  serialize(header, writer);
+}
+
+void finish_game_frame(std::vector<uint8_t> &frame) {
+  PacketHeader header;
+  header.type = PacketType::GAME_FRAME;
+  header.size_of_data_without_header =
+      static_cast<uint32_t>(frame.size() - size_when_serialized<PacketHeader>);
+  ByteWriter writer(
+      std::span<uint8_t>(frame.data(), size_when_serialized<PacketHeader>));
+  serialize(header, writer);
+}
+
+bool split_game_frame(std::span<const uint8_t> frame,
+                      std::vector<PacketWithSize> &packets) {
+  ByteReader reader(frame);
+  PacketHeader frame_header;
+  std::span<const uint8_t> payload;
+  if (not deserialize(reader, frame_header) or
+      frame_header.type != PacketType::GAME_FRAME or
+      not reader.read_span(frame_header.size_of_data_without_header,
+                           payload)) {
+    return false;
+  }
+
+  size_t packet_count_before = packets.size();
+  ByteReader payload_reader(payload);
+  while (payload_reader.get_bytes_remaining() > 0) {
+    size_t packet_start = payload_reader.get_offset();
+    PacketHeader header;
+    std::span<const uint8_t> data;
+    if (not deserialize(payload_reader, header) or
+        header.type == PacketType::GAME_FRAME or
+        not payload_reader.read_span(header.size_of_data_without_header,
+                                     data)) {
+      packets.resize(packet_count_before);
+      return false;
+    }
+    std::span<const uint8_t> packet_bytes = payload.subspan(
+        packet_start, payload_reader.get_offset() - packet_start);
+    PacketWithSize &packet = packets.emplace_back();
+    packet.data.assign(packet_bytes.begin(), packet_bytes.end());
+    packet.size = packet_bytes.size();
+  }
+  return true;
+}
+
+bool peek_client_id_of_quantized_mouse_update(std::span<const uint8_t> buffer,
+                                              unsigned int &client_id) {
+  ByteReader reader(buffer);
+  PacketHeader header;
+  std::span<const uint8_t> payload;
+  if (not deserialize(reader, header) or
+      not reader.read_span(header.size_of_data_without_header, payload)) {
+    return false;
+  }
+
+  BitReader bit_reader(payload);
+  uint32_t raw_client_id = 0;
+  if (not bit_reader.read_bits(raw_client_id,
+                               quantization::client_id_bit_count)) {
+    return false;
+  }
+  client_id = raw_client_id;
+  return true;
+}
+
+} // namespace wire_format
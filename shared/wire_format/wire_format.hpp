@@ -0,0 +1,606 @@
+#ifndef WIRE_FORMAT_HPP
+#define WIRE_FORMAT_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <numbers>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../packets/packets.hpp"
+
+// NOTE: the serializers in the generated MetaProgram build a fresh vector per
+// field and copy a slice per field when reading, which is around a dozen heap
+// allocations per packet. These produce and consume the exact same bytes, but
+// write straight into a caller provided buffer and read from a span with a
+// running offset, so steady state sending and receiving does not allocate.
+
+namespace wire_format {
+
+class ByteWriter {
+public:
+  // NOTE: writes into fixed storage, anything that doesn't fit is dropped and
+  // has_overflowed becomes true
+  explicit ByteWriter(std::span<uint8_t> destination)
+      : destination(destination), growable_destination(nullptr) {}
+
+  // NOTE: appends to the vector, if it is reused between packets its capacity
+  // is kept and after the first packet nothing is allocated
+  explicit ByteWriter(std::vector<uint8_t> &growable_destination)
+      : growable_destination(&growable_destination),
+        offset(growable_destination.size()) {}
+
+  void write_bytes(const void *data, size_t size) {
+    if (growable_destination != nullptr) {
+      growable_destination->resize(offset + size);
+      std::memcpy(growable_destination->data() + offset, data, size);
+    } else {
+      if (overflowed or offset + size > destination.size()) {
+        overflowed = true;
+        return;
+      }
+      std::memcpy(destination.data() + offset, data, size);
+    }
+    offset += size;
+  }
+
+  template <typename T> void write_trivial(const T &value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    write_bytes(&value, sizeof(T));
+  }
+
+  size_t get_bytes_written() const { return offset; }
+  bool has_overflowed() const { return overflowed; }
+
+private:
+  std::span<uint8_t> destination;
+  std::vector<uint8_t> *growable_destination;
+  size_t offset = 0;
+  bool overflowed = false;
+};
+
+class ByteReader {
+public:
+  explicit ByteReader(std::span<const uint8_t> source) : source(source) {}
+
+  // NOTE: returns false and leaves the output untouched if there are not
+  // enough bytes left
+  bool read_bytes(void *data, size_t size) {
+    if (underflowed or offset + size > source.size()) {
+      underflowed = true;
+      return false;
+    }
+    std::memcpy(data, source.data() + offset, size);
+    offset += size;
+    return true;
+  }
+
+  template <typename T> bool read_trivial(T &value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    return read_bytes(&value, sizeof(T));
+  }
+
+  // NOTE: hands out a view of the next size bytes without copying them
+  bool read_span(size_t size, std::span<const uint8_t> &bytes) {
+    if (underflowed or offset + size > source.size()) {
+      underflowed = true;
+      return false;
+    }
+    bytes = source.subspan(offset, size);
+    offset += size;
+    return true;
+  }
+
+  size_t get_offset() const { return offset; }
+  size_t get_bytes_remaining() const { return source.size() - offset; }
+  bool has_underflowed() const { return underflowed; }
+
+private:
+  std::span<const uint8_t> source;
+  size_t offset = 0;
+  bool underflowed = false;
+};
+
+// NOTE: packs values into a byte buffer using exactly as many bits as asked
+// for, least significant bit first, call finish before reading the size.
+class BitWriter {
+public:
+  explicit BitWriter(std::span<uint8_t> destination)
+      : destination(destination) {}
+
+  void write_bits(uint32_t value, unsigned int bit_count) {
+    uint64_t mask = (uint64_t(1) << bit_count) - 1;
+    scratch |= (uint64_t(value) & mask) << scratch_bit_count;
+    scratch_bit_count += bit_count;
+    while (scratch_bit_count >= 8) {
+      emit_byte();
+    }
+  }
+
+  void write_bool(bool value) { write_bits(value ? 1 : 0, 1); }
+
+  // NOTE: flushes the last partially filled byte, the unused bits are zero
+  void finish() {
+    if (scratch_bit_count > 0) {
+      emit_byte();
+    }
+  }
+
+  size_t get_bytes_written() const { return byte_offset; }
+  bool has_overflowed() const { return overflowed; }
+
+private:
+  void emit_byte() {
+    if (byte_offset < destination.size()) {
+      destination[byte_offset] = static_cast<uint8_t>(scratch & 0xff);
+    } else {
+      overflowed = true;
+    }
+    byte_offset++;
+    scratch >>= 8;
+    scratch_bit_count = scratch_bit_count >= 8 ? scratch_bit_count - 8 : 0;
+  }
+
+  std::span<uint8_t> destination;
+  uint64_t scratch = 0;
+  unsigned int scratch_bit_count = 0;
+  size_t byte_offset = 0;
+  bool overflowed = false;
+};
+
+class BitReader {
+public:
+  explicit BitReader(std::span<const uint8_t> source) : source(source) {}
+
+  // NOTE: returns false once the source has run out of bits
+  bool read_bits(uint32_t &value, unsigned int bit_count) {
+    while (scratch_bit_count < bit_count) {
+      if (byte_offset >= source.size()) {
+        return false;
+      }
+      scratch |= uint64_t(source[byte_offset]) << scratch_bit_count;
+      byte_offset++;
+      scratch_bit_count += 8;
+    }
+    uint64_t mask = (uint64_t(1) << bit_count) - 1;
+    value = static_cast<uint32_t>(scratch & mask);
+    scratch >>= bit_count;
+    scratch_bit_count -= bit_count;
+    return true;
+  }
+
+  bool read_bool(bool &value) {
+    uint32_t raw = 0;
+    if (not read_bits(raw, 1)) {
+      return false;
+    }
+    value = raw != 0;
+    return true;
+  }
+
+private:
+  std::span<const uint8_t> source;
+  uint64_t scratch = 0;
+  unsigned int scratch_bit_count = 0;
+  size_t byte_offset = 0;
+};
+
+// NOTE: maps [min, max] onto the integers [0, 2^bit_count - 1], values outside
+// of the range are clamped, a value that was in range comes back within half
+// a step of where it started.
+struct QuantizedRange {
+  double min;
+  double max;
+  unsigned int bit_count;
+
+  constexpr uint32_t get_max_quantized_value() const {
+    return static_cast<uint32_t>((uint64_t(1) << bit_count) - 1);
+  }
+  constexpr double get_step() const {
+    return (max - min) / get_max_quantized_value();
+  }
+  constexpr double get_max_error() const { return get_step() / 2; }
+};
+
+uint32_t quantize(double value, const QuantizedRange &range);
+double dequantize(uint32_t quantized_value, const QuantizedRange &range);
+
+// NOTE: update numbers are only sent as their low bits, the receiver picks the
+// full value closest to one it already knows (its own latest update number for
+// example), this is correct as long as the two are less than 2^15 apart. A
+// game update's own number is sent with all 32 bits to a client that has
+// nothing to reconstruct it from yet, see serialize_quantized and
+// serialize_delta.
+inline constexpr unsigned int sequence_number_bit_count = 16;
+inline constexpr unsigned int full_sequence_number_bit_count = 32;
+unsigned int reconstruct_sequence_number(uint32_t low_bits,
+                                         unsigned int reference);
+
+// NOTE: the quantized encoding of GameUpdate and MouseUpdate, sent as
+// GAME_UPDATE_QUANTIZED and MOUSE_UPDATE_QUANTIZED, the precision lost is:
+//
+// field                               | bits | max error
+// ------------------------------------+------+----------------------------
+// client id                           | 32   | none
+// update numbers                      | 16   | none (see above)
+// game update number                  | 17   | none, 33 until acknowledged
+// yaw, wrapped to [-pi, pi]           | 18   | 1.2e-5 rad
+// pitch                               | 17   | 1.2e-5 rad
+// target position, each axis          | 16   | 0.25 mm in [-16, 16]
+// target velocity, each axis          | 14   | 2 mm/s in [-32, 32]
+// mouse position, 1/16 px fixed point | 32   | 1/32 px
+// subtick mouse position offset       | 17   | 1/32 px in [-4096, 4096]
+// subtick percentage                  | 10   | 4.9e-4
+// entity extrapolation, when starved  | 1+11 | 6.1e-5 s in [0, 0.25]
+// sensitivity, as a float             | 32   | float rounding
+//
+// the subtick fields of a MouseUpdate are only sent when fire_pressed is set,
+// they are only ever read on the server when a shot is fired and otherwise
+// come out as zero, likewise last_received_game_update_number is only sent
+// when has_received_game_update is set. Of the entity extrapolation only a bit
+// saying there is none is sent when the client wasn't extrapolating, which is
+// almost always, longer extrapolations than the range are sent as its max.
+namespace quantization {
+inline constexpr QuantizedRange yaw{-std::numbers::pi, std::numbers::pi, 18};
+inline constexpr QuantizedRange pitch{-std::numbers::pi / 2,
+                                      std::numbers::pi / 2, 17};
+inline constexpr QuantizedRange target_position{-16.0, 16.0, 16};
+inline constexpr QuantizedRange target_velocity{-32.0, 32.0, 14};
+inline constexpr QuantizedRange subtick_percentage{0.0, 1.0, 10};
+inline constexpr QuantizedRange entity_extrapolation{0.0, 0.25, 11};
+inline constexpr QuantizedRange subtick_mouse_position_offset{-4096.0, 4096.0,
+                                                              17};
+inline constexpr unsigned int client_id_bit_count = 32;
+inline constexpr double mouse_position_fixed_point_scale = 16.0;
+inline constexpr unsigned int mouse_position_bit_count = 32;
+inline constexpr unsigned int sensitivity_bit_count = 32;
+
+inline constexpr unsigned int game_update_bit_count =
+    client_id_bit_count + sequence_number_bit_count + 1 +
+    full_sequence_number_bit_count + yaw.bit_count +
+    pitch.bit_count + 3 * target_position.bit_count +
+    3 * target_velocity.bit_count;
+
+inline constexpr unsigned int mouse_update_bit_count_without_firing =
+    client_id_bit_count + 2 * sequence_number_bit_count + 2 +
+    2 * mouse_position_bit_count + sensitivity_bit_count;
+
+inline constexpr unsigned int mouse_update_max_bit_count =
+    mouse_update_bit_count_without_firing + 2 * sequence_number_bit_count +
+    subtick_percentage.bit_count + 1 + entity_extrapolation.bit_count +
+    2 * subtick_mouse_position_offset.bit_count;
+
+// NOTE: a delta game update is whether a baseline is used, then the update
+// number and the baseline's update number or, without a baseline, the full
+// update number as the client may have nothing to reconstruct it from yet,
+// then one bit per field in delta_game_update_field_bit_counts saying whether
+// that field is present, followed by the present fields quantized as above.
+// Without a baseline every field is present which is the full snapshot
+// fallback.
+inline constexpr std::array<unsigned int, 10> delta_game_update_field_bit_counts =
+    {client_id_bit_count,       sequence_number_bit_count,
+     yaw.bit_count,             pitch.bit_count,
+     target_position.bit_count, target_position.bit_count,
+     target_position.bit_count, target_velocity.bit_count,
+     target_velocity.bit_count, target_velocity.bit_count};
+
+inline constexpr unsigned int delta_game_update_max_bit_count =
+    1 + std::max(2 * sequence_number_bit_count, full_sequence_number_bit_count) +
+    delta_game_update_field_bit_counts.size() + client_id_bit_count +
+    sequence_number_bit_count + yaw.bit_count + pitch.bit_count + 3 * target_position.bit_count +
+    3 * target_velocity.bit_count;
+
+// NOTE: a mouse update window is the client id, the number of mouse updates
+// in it minus one, the game update acknowledgement (shared by all of them) and
+// then the mouse updates newest first. The newest is encoded as in
+// MOUSE_UPDATE_QUANTIZED, every older one relative to the one after it: one
+// bit when its update number is the one right before, otherwise how far back
+// it is, its mouse position as a small fixed point difference when it fits and
+// in full otherwise, its sensitivity only if it changed and then the firing
+// fields as usual. Mouse updates that are too far apart to encode the gap end
+// the window early. The client sends one mouse update per mouse sample, so the
+// common case of consecutive samples a few pixels apart costs 29 bits.
+inline constexpr size_t max_mouse_update_window_size = 64;
+inline constexpr unsigned int mouse_update_window_count_bit_count = 6;
+inline constexpr unsigned int mouse_update_window_gap_bit_count = 8;
+inline constexpr unsigned int mouse_position_difference_bit_count = 12;
+
+inline constexpr unsigned int mouse_update_firing_bit_count =
+    2 * sequence_number_bit_count + subtick_percentage.bit_count + 1 +
+    entity_extrapolation.bit_count +
+    2 * subtick_mouse_position_offset.bit_count;
+
+inline constexpr unsigned int older_mouse_update_in_window_max_bit_count =
+    1 + mouse_update_window_gap_bit_count + 2 * (1 + mouse_position_bit_count) +
+    1 + sensitivity_bit_count + 1 + mouse_update_firing_bit_count;
+
+inline constexpr unsigned int mouse_update_window_max_bit_count =
+    client_id_bit_count + mouse_update_window_count_bit_count + 1 +
+    sequence_number_bit_count + sequence_number_bit_count +
+    2 * mouse_position_bit_count + sensitivity_bit_count + 1 +
+    mouse_update_firing_bit_count +
+    (max_mouse_update_window_size - 1) *
+        older_mouse_update_in_window_max_bit_count;
+
+constexpr size_t bits_to_bytes(unsigned int bit_count) {
+  return (bit_count + 7) / 8;
+}
+} // namespace quantization
+
+// NOTE: FixedWireSize<T>::value is the number of bytes T serializes to, it is
+// only defined for types whose every field has a fixed size, so anything
+// variable length like PacketWithSize is left out and is_fixed_size_v is false
+template <typename T> struct FixedWireSize {};
+
+template <typename T>
+inline constexpr bool is_fixed_size_v = requires { FixedWireSize<T>::value; };
+
+template <typename T>
+inline constexpr size_t size_when_serialized = FixedWireSize<T>::value;
+
+template <typename... Fields>
+inline constexpr size_t sum_of_sizes = (FixedWireSize<Fields>::value + ...);
+
+template <typename T>
+  requires std::is_arithmetic_v<T>
+struct FixedWireSize<T> : std::integral_constant<size_t, sizeof(T)> {};
+
+// NOTE: bools are written as a single byte regardless of sizeof(bool)
+template <>
+struct FixedWireSize<bool> : std::integral_constant<size_t, sizeof(uint8_t)> {};
+
+template <>
+struct FixedWireSize<PacketType>
+    : std::integral_constant<size_t, sizeof(uint8_t)> {};
+
+template <>
+struct FixedWireSize<SoundType> : std::integral_constant<size_t, sizeof(int)> {
+};
+
+// NOTE: the wire size of each struct in packets.hpp is worked out from its own
+// fields rather than listed by hand, so adding a field to one changes its size
+// here too, the serializers write every field in declaration order as
+// FixedWireSize of its type. The fields are counted by how many AnyFields the
+// struct can be aggregate initialized from, and a structured binding of that
+// many names then gets at their types.
+namespace detail {
+struct AnyField {
+  template <typename T> constexpr operator T() const;
+};
+
+template <typename T, typename... Fields> constexpr size_t count_fields() {
+  if constexpr (requires { T{Fields{}..., AnyField{}}; }) {
+    return count_fields<T, Fields..., AnyField>();
+  } else {
+    return sizeof...(Fields);
+  }
+}
+
+template <typename... Fields>
+constexpr auto sum_of_field_sizes(const Fields &...) {
+  return std::integral_constant<size_t, sum_of_sizes<Fields...>>{};
+}
+
+// NOTE: only ever used in decltype, nothing is bound at runtime
+template <typename T> constexpr auto sum_of_field_sizes_of(const T &object) {
+  constexpr size_t field_count = count_fields<T>();
+  static_assert(field_count >= 1 and field_count <= 16,
+                "add a case below for structs with this many fields");
+  if constexpr (field_count == 1) {
+    const auto &[f0] = object;
+    return sum_of_field_sizes(f0);
+  } else if constexpr (field_count == 2) {
+    const auto &[f0, f1] = object;
+    return sum_of_field_sizes(f0, f1);
+  } else if constexpr (field_count == 3) {
+    const auto &[f0, f1, f2] = object;
+    return sum_of_field_sizes(f0, f1, f2);
+  } else if constexpr (field_count == 4) {
+    const auto &[f0, f1, f2, f3] = object;
+    return sum_of_field_sizes(f0, f1, f2, f3);
+  } else if constexpr (field_count == 5) {
+    const auto &[f0, f1, f2, f3, f4] = object;
+    return sum_of_field_sizes(f0, f1, f2, f3, f4);
+  } else if constexpr (field_count == 6) {
+    const auto &[f0, f1, f2, f3, f4, f5] = object;
+    return sum_of_field_sizes(f0, f1, f2, f3, f4, f5);
+  } else if constexpr (field_count == 7) {
+    const auto &[f0, f1, f2, f3, f4, f5, f6] = object;
+    return sum_of_field_sizes(f0, f1, f2, f3, f4, f5, f6);
+  } else if constexpr (field_count == 8) {
+    const auto &[f0, f1, f2, f3, f4, f5, f6, f7] = object;
+    return sum_of_field_sizes(f0, f1, f2, f3, f4, f5, f6, f7);
+  } else if constexpr (field_count == 9) {
+    const auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8] = object;
+    return sum_of_field_sizes(f0, f1, f2, f3, f4, f5, f6, f7, f8);
+  } else if constexpr (field_count == 10) {
+    const auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9] = object;
+    return sum_of_field_sizes(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9);
+  } else if constexpr (field_count == 11) {
+    const auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10] = object;
+    return sum_of_field_sizes(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10);
+  } else if constexpr (field_count == 12) {
+    const auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11] = object;
+    return sum_of_field_sizes(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10,
+                              f11);
+  } else if constexpr (field_count == 13) {
+    const auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12] =
+        object;
+    return sum_of_field_sizes(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10,
+                              f11, f12);
+  } else if constexpr (field_count == 14) {
+    const auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13] =
+        object;
+    return sum_of_field_sizes(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10,
+                              f11, f12, f13);
+  } else if constexpr (field_count == 15) {
+    const auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13,
+                 f14] = object;
+    return sum_of_field_sizes(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10,
+                              f11, f12, f13, f14);
+  } else {
+    const auto &[f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13,
+                 f14, f15] = object;
+    return sum_of_field_sizes(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10,
+                              f11, f12, f13, f14, f15);
+  }
+}
+} // namespace detail
+
+template <typename T>
+using SumOfFieldSizes =
+    decltype(detail::sum_of_field_sizes_of(std::declval<const T &>()));
+
+// NOTE: PacketHeader comes from packet_data and isn't ours to count, its type
+// is written as a single byte followed by the size
+template <>
+struct FixedWireSize<PacketHeader>
+    : std::integral_constant<size_t, sum_of_sizes<PacketType, uint32_t>> {};
+
+template <> struct FixedWireSize<MouseUpdate> : SumOfFieldSizes<MouseUpdate> {};
+template <> struct FixedWireSize<GameUpdate> : SumOfFieldSizes<GameUpdate> {};
+template <> struct FixedWireSize<SoundUpdate> : SumOfFieldSizes<SoundUpdate> {};
+template <>
+struct FixedWireSize<MouseUpdatePacket> : SumOfFieldSizes<MouseUpdatePacket> {
+};
+template <>
+struct FixedWireSize<GameUpdatePacket> : SumOfFieldSizes<GameUpdatePacket> {};
+template <>
+struct FixedWireSize<SoundUpdatePacket> : SumOfFieldSizes<SoundUpdatePacket> {
+};
+
+// NOTE: what the fields above come to today, a change here means the bytes on
+// the wire changed and the serializers and every peer have to follow
+static_assert(size_when_serialized<PacketHeader> == 5);
+static_assert(size_when_serialized<MouseUpdate> == 4 * 5 + 1 * 2 + 8 * 7);
+static_assert(size_when_serialized<GameUpdate> == 4 * 3 + 8 * 8);
+static_assert(size_when_serialized<SoundUpdate> == 4 + 8 * 3);
+
+// NOTE: a stack buffer exactly large enough for one serialized T
+template <typename T>
+using FixedSizeBuffer = std::array<uint8_t, size_when_serialized<T>>;
+
+void serialize(const PacketHeader &header, ByteWriter &writer);
+void serialize(const MouseUpdate &mouse_update, ByteWriter &writer);
+void serialize(const GameUpdate &game_update, ByteWriter &writer);
+void serialize(const SoundUpdate &sound_update, ByteWriter &writer);
+void serialize(const MouseUpdatePacket &packet, ByteWriter &writer);
+void serialize(const GameUpdatePacket &packet, ByteWriter &writer);
+void serialize(const SoundUpdatePacket &packet, ByteWriter &writer);
+
+// NOTE: each of these returns false if the buffer ran out before the object
+// was fully read
+bool deserialize(ByteReader &reader, PacketHeader &header);
+bool deserialize(ByteReader &reader, MouseUpdate &mouse_update);
+bool deserialize(ByteReader &reader, GameUpdate &game_update);
+bool deserialize(ByteReader &reader, SoundUpdate &sound_update);
+bool deserialize(ByteReader &reader, MouseUpdatePacket &packet);
+bool deserialize(ByteReader &reader, GameUpdatePacket &packet);
+bool deserialize(ByteReader &reader, SoundUpdatePacket &packet);
+
+// NOTE: these write a PacketHeader of type GAME_UPDATE_QUANTIZED or
+// MOUSE_UPDATE_QUANTIZED followed by the bit packed fields, pass
+// send_full_update_number until the client has acknowledged a game update, up
+// to then it has no reference to reconstruct the update number from.
+void serialize_quantized(const GameUpdate &game_update,
+                         bool send_full_update_number, ByteWriter &writer);
+void serialize_quantized(const MouseUpdate &mouse_update, ByteWriter &writer);
+
+// NOTE: the references are used to reconstruct the full update numbers, on the
+// client they are the last received game update number and its own latest
+// mouse pos update number, on the server the last processed mouse pos update
+// number and its own current update number.
+bool deserialize_quantized(ByteReader &reader, GameUpdate &game_update,
+                           unsigned int update_number_reference,
+                           unsigned int mouse_pos_update_number_reference);
+bool deserialize_quantized(ByteReader &reader, MouseUpdate &mouse_update,
+                           unsigned int mouse_pos_update_number_reference,
+                           unsigned int game_update_number_reference);
+
+// NOTE: writes a MOUSE_UPDATE_WINDOW holding the last (up to
+// max_mouse_update_window_size) of mouse_updates, which must not be empty, are
+// oldest first and have increasing update numbers, the client id and game update
+// acknowledgement are taken from the newest. Sending the mouse updates the
+// server hasn't acknowledged yet in every packet means a lost packet doesn't
+// lose its input (or its shot) as long as a later packet makes it.
+void serialize_mouse_update_window(std::span<const MouseUpdate> mouse_updates,
+                                   ByteWriter &writer);
+
+// NOTE: appends the mouse updates in a MOUSE_UPDATE_WINDOW to mouse_updates
+// oldest first, the references are the same as for deserialize_quantized and
+// are used for the newest mouse update, returns false and leaves mouse_updates
+// as it was if the buffer ran out
+bool deserialize_mouse_update_window(
+    ByteReader &reader, std::vector<MouseUpdate> &mouse_updates,
+    unsigned int mouse_pos_update_number_reference,
+    unsigned int game_update_number_reference);
+
+// NOTE: the references needed above are per client, so when the transport
+// doesn't say who sent a MOUSE_UPDATE_QUANTIZED or MOUSE_UPDATE_WINDOW the
+// server first reads which client it claims to be from with this
+bool peek_client_id_of_quantized_mouse_update(std::span<const uint8_t> buffer,
+                                              unsigned int &client_id);
+
+// NOTE: writes a GAME_UPDATE_DELTA which only contains the fields of
+// game_update whose quantized value differs from the one in baseline, baseline
+// must be a game update the client has acknowledged, pass nullptr when there
+// is none and every field is sent along with the full update number.
+void serialize_delta(const GameUpdate &game_update, const GameUpdate *baseline,
+                     ByteWriter &writer);
+
+// NOTE: get_baseline returns the previously received game update with the given
+// update number or nullptr if it is no longer around, in that case (or if the
+// buffer ran out) false is returned and the packet should be dropped, the
+// references are the same as for deserialize_quantized.
+bool deserialize_delta(
+    ByteReader &reader, GameUpdate &game_update,
+    unsigned int update_number_reference,
+    unsigned int mouse_pos_update_number_reference,
+    const std::function<const GameUpdate *(unsigned int)> &get_baseline);
+
+// NOTE: a GAME_FRAME carries everything the server has for a client on one
+// tick in a single datagram, it is a header whose size covers the rest of the
+// frame followed by complete packets (each with its own header) laid end to
+// end, the game update comes first and then that tick's events such as sound
+// updates, so events can't show up without the state they belong to.
+// start_game_frame clears frame and writes a placeholder header, append the
+// packets with a ByteWriter over frame and then call finish_game_frame which
+// fills in the size.
+void start_game_frame(std::vector<uint8_t> &frame);
+void finish_game_frame(std::vector<uint8_t> &frame);
+
+// NOTE: appends the packets inside a GAME_FRAME to packets so they can be
+// handed to the usual handlers, returns false and leaves packets as it was if
+// the frame is truncated or contains another frame
+bool split_game_frame(std::span<const uint8_t> frame,
+                      std::vector<PacketWithSize> &packets);
+
+inline constexpr size_t max_size_when_quantized_game_update =
+    size_when_serialized<PacketHeader> +
+    quantization::bits_to_bytes(quantization::game_update_bit_count);
+inline constexpr size_t max_size_when_quantized_mouse_update =
+    size_when_serialized<PacketHeader> +
+    quantization::bits_to_bytes(quantization::mouse_update_max_bit_count);
+inline constexpr size_t max_size_when_delta_game_update =
+    size_when_serialized<PacketHeader> +
+    quantization::bits_to_bytes(quantization::delta_game_update_max_bit_count);
+inline constexpr size_t max_size_when_mouse_update_window =
+    size_when_serialized<PacketHeader> +
+    quantization::bits_to_bytes(
+        quantization::mouse_update_window_max_bit_count);
+
+template <typename T>
+bool deserialize(std::span<const uint8_t> buffer, T &obj) {
+  ByteReader reader(buffer);
+  return deserialize(reader, obj);
+}
+
+} // namespace wire_format
+
+#endif // WIRE_FORMAT_HPP